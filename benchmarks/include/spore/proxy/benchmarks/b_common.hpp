@@ -0,0 +1,77 @@
+#pragma once
+
+#include "spore/proxy/proxy_macros.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace spore::benchmarks
+{
+    struct result
+    {
+        std::string name;
+        std::double_t time;
+    };
+
+    template <typename value_t>
+    SPORE_PROXY_FORCE_INLINE void do_not_optimize(value_t& value)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        (void) value;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    inline void output_results(const std::span<const result> results)
+    {
+        std::cout << std::format("| {0:-^40} | {0:-^10} |", "") << std::endl;
+        std::cout << std::format("| {:<40} | {:>10} |", "Name", "Seconds") << std::endl;
+        std::cout << std::format("| {0:-^40} | {0:-^10} |", "") << std::endl;
+
+        for (const result& result : results)
+        {
+            std::cout << std::format("| {:<40} | {:>10.4f} |", result.name, result.time) << std::endl;
+        }
+
+        std::cout << std::format("| {0:-^40} | {0:-^10} |", "") << std::endl;
+    }
+
+    template <typename func_t>
+    result run_benchmark(const std::string_view name, func_t&& func)
+    {
+        const auto then = std::chrono::steady_clock::now();
+
+        func();
+
+        const auto now = std::chrono::steady_clock::now();
+        const std::chrono::duration<std::double_t> duration = now - then;
+
+        return result {
+            .name = std::string {name},
+            .time = duration.count(),
+        };
+    }
+
+    void run_shared_benchmarks(std::vector<result>& results);
+    void run_intrusive_benchmarks(std::vector<result>& results);
+    void run_relocate_benchmarks(std::vector<result>& results);
+    void run_lifecycle_benchmarks(std::vector<result>& results);
+    void run_cow_benchmarks(std::vector<result>& results);
+    void run_variant_benchmarks(std::vector<result>& results);
+    void run_lazy_benchmarks(std::vector<result>& results);
+    void run_weak_benchmarks(std::vector<result>& results);
+    void run_instrument_benchmarks(std::vector<result>& results);
+    void run_devirtualize_benchmarks(std::vector<result>& results);
+    void run_replay_benchmarks(std::vector<result>& results);
+    void run_bind_benchmarks(std::vector<result>& results);
+    void run_multi_benchmarks(std::vector<result>& results);
+    void run_slots_benchmarks(std::vector<result>& results);
+    void run_emplace_benchmarks(std::vector<result>& results);
+    void run_range_benchmarks(std::vector<result>& results);
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "spore/proxy/proxy.hpp"
+
+#include <cstddef>
+
+namespace spore::benchmarks::devirtualize
+{
+    inline constexpr std::size_t value_count = 8;
+
+    template <typename dispatch_t>
+    struct facade : proxy_facade<facade<dispatch_t>>
+    {
+        using dispatch_type [[maybe_unused]] = dispatch_t;
+
+        std::size_t work(const std::size_t value) const
+        {
+            constexpr auto func = [](const auto& self, const std::size_t value) { return self.work(value); };
+            return proxies::dispatch<std::size_t>(func, *this, value);
+        }
+    };
+
+    template <std::size_t index_v>
+    struct impl
+    {
+        std::size_t work(const std::size_t value) const
+        {
+            return value * (index_v + 1) + index_v;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+// generated by spore::proxies::dispatch_profile_header from a profiling run
+
+template <>
+struct spore::proxy_dispatch_profile<spore::benchmarks::devirtualize::facade<spore::proxy_dispatch_speculative<spore::proxy_dispatch_dynamic<> > >> : spore::proxy_dispatch_hot<spore::benchmarks::devirtualize::impl<0>, spore::benchmarks::devirtualize::impl<1>>
+{
+};
+
+template <>
+struct spore::proxy_dispatch_profile<spore::benchmarks::devirtualize::facade<spore::proxy_dispatch_speculative<spore::proxy_dispatch_static<> > >> : spore::proxy_dispatch_hot<spore::benchmarks::devirtualize::impl<0>, spore::benchmarks::devirtualize::impl<1>>
+{
+};
\ No newline at end of file
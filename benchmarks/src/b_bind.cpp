@@ -0,0 +1,69 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+namespace spore::benchmarks
+{
+    namespace bind
+    {
+        template <typename dispatch_t>
+        struct facade : proxy_facade<facade<dispatch_t>>
+        {
+            using dispatch_type [[maybe_unused]] = dispatch_t;
+
+            std::size_t work(const std::size_t value) const
+            {
+                return proxies::dispatch<std::size_t>(work_func, *this, value);
+            }
+
+            static constexpr auto work_func = [](const auto& self, const std::size_t value) { return self.work(value); };
+        };
+
+        struct impl
+        {
+            std::size_t offset = 0;
+
+            std::size_t work(const std::size_t value) const
+            {
+                return value ^ offset;
+            }
+        };
+    }
+
+    void run_bind_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t dispatch_iterations = 100000000;
+
+        const auto benchmark = [&]<typename dispatch_t>(const std::string_view dispatch_name, const std::string_view bind_name) {
+            using facade_t = bind::facade<dispatch_t>;
+
+            const value_proxy<facade_t> proxy = proxies::make_value<facade_t>(bind::impl {.offset = 42});
+
+            results.emplace_back() = run_benchmark(dispatch_name, [&] {
+                std::size_t sum = 0;
+
+                for (std::size_t index = 0; index < dispatch_iterations; ++index)
+                {
+                    sum += proxy.work(index);
+                }
+
+                do_not_optimize(sum);
+            });
+
+            results.emplace_back() = run_benchmark(bind_name, [&] {
+                const auto work = proxies::bind<std::size_t(std::size_t)>(facade_t::work_func, proxy);
+
+                std::size_t sum = 0;
+
+                for (std::size_t index = 0; index < dispatch_iterations; ++index)
+                {
+                    sum += work(index);
+                }
+
+                do_not_optimize(sum);
+            });
+        };
+
+        benchmark.template operator()<proxy_dispatch_static<>>("static loop dispatch", "static loop bind");
+        benchmark.template operator()<proxy_dispatch_dynamic<>>("dynamic loop dispatch", "dynamic loop bind");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <array>
+
+namespace spore::benchmarks
+{
+    namespace cow
+    {
+        struct facade : proxy_facade<facade>
+        {
+            std::size_t read() const
+            {
+                constexpr auto func = [](const auto& self) { return self.read(); };
+                return proxies::dispatch<std::size_t>(func, *this);
+            }
+
+            void write(const std::size_t value)
+            {
+                constexpr auto func = [](auto& self, const std::size_t value) { self.write(value); };
+                proxies::dispatch(func, *this, value);
+            }
+        };
+
+        struct impl
+        {
+            std::array<std::size_t, 1024> values {};
+
+            std::size_t read() const
+            {
+                return values[0];
+            }
+
+            void write(const std::size_t value)
+            {
+                values[0] = value;
+            }
+        };
+
+        template <typename proxy_t>
+        SPORE_PROXY_FORCE_INLINE void copy_and_read(const proxy_t& proxy, const std::size_t iterations)
+        {
+            for (std::size_t index = 0; index < iterations; ++index)
+            {
+                proxy_t copy = proxy;
+                std::size_t value = copy.read();
+                do_not_optimize(value);
+            }
+        }
+
+        template <typename proxy_t>
+        SPORE_PROXY_FORCE_INLINE void copy_and_write(const proxy_t& proxy, const std::size_t iterations)
+        {
+            for (std::size_t index = 0; index < iterations; ++index)
+            {
+                proxy_t copy = proxy;
+                copy.write(index);
+                do_not_optimize(copy);
+            }
+        }
+    }
+
+    void run_cow_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t iterations = 10000000;
+
+        const auto benchmark = [&]<typename proxy_t>(const std::string_view name, const proxy_t& proxy) {
+            results.emplace_back() = run_benchmark(std::format("{} copy-heavy", name), [&] {
+                cow::copy_and_read(proxy, iterations);
+            });
+
+            results.emplace_back() = run_benchmark(std::format("{} mutate-heavy", name), [&] {
+                cow::copy_and_write(proxy, iterations);
+            });
+        };
+
+        benchmark("value", proxies::make_value<cow::facade, cow::impl>());
+        benchmark("cow", proxies::make_cow<cow::facade, cow::impl>());
+    }
+}
\ No newline at end of file
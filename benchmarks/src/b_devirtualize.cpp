@@ -0,0 +1,105 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/benchmarks/b_devirtualize.hpp"
+#include "spore/proxy/proxy.hpp"
+
+// generated from a run of these benchmarks with SPORE_PROXY_INSTRUMENT defined
+#include "spore/proxy/benchmarks/b_devirtualize_profile.hpp"
+
+#include <array>
+#include <utility>
+
+namespace spore::benchmarks
+{
+    namespace devirtualize
+    {
+        // a megamorphic call site, skewed picks one of the two hottest values nine times out of ten
+        template <typename facade_t>
+        std::vector<value_proxy<facade_t>> make_proxies(const std::size_t count, const bool skewed)
+        {
+            const auto make_proxy = [&]<std::size_t... indices_v>(std::index_sequence<indices_v...>, const std::size_t index) {
+                constexpr std::array<value_proxy<facade_t> (*)(), sizeof...(indices_v)> makers {
+                    [] { return proxies::make_value<facade_t>(impl<indices_v> {}); }...,
+                };
+
+                return makers[index]();
+            };
+
+            std::vector<value_proxy<facade_t>> values;
+            values.reserve(count);
+
+            std::uint32_t seed = 0x2545f491;
+
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                seed = seed * 1664525 + 1013904223;
+
+                const std::size_t roll = seed >> 24;
+                const std::size_t value_index = skewed and roll < 230 ? roll % 2 : roll % value_count;
+
+                values.emplace_back(make_proxy(std::make_index_sequence<value_count> {}, value_index));
+            }
+
+            return values;
+        }
+    }
+
+    void run_devirtualize_benchmarks(std::vector<result>& results)
+    {
+        // too many for the branch predictor to learn the sequence of values
+        constexpr std::size_t proxy_count = 65536;
+        constexpr std::size_t dispatch_iterations = 10000000;
+
+        const auto benchmark = [&]<typename dispatch_t>(const std::string_view name, const bool skewed) {
+            using facade_t = devirtualize::facade<dispatch_t>;
+
+            const std::vector<value_proxy<facade_t>> values = devirtualize::make_proxies<facade_t>(proxy_count, skewed);
+
+            results.emplace_back() = run_benchmark(name, [&] {
+                std::size_t sum = 0;
+
+                for (std::size_t index = 0; index < dispatch_iterations; ++index)
+                {
+                    sum += values[index % proxy_count].work(index);
+                }
+
+                do_not_optimize(sum);
+            });
+        };
+
+        // the two hottest values special-cased by hand, the others dispatched
+        const auto benchmark_known = [&]<typename dispatch_t>(const std::string_view name, const bool skewed) {
+            using facade_t = devirtualize::facade<dispatch_t>;
+
+            const std::vector<value_proxy<facade_t>> values = devirtualize::make_proxies<facade_t>(proxy_count, skewed);
+
+            results.emplace_back() = run_benchmark(name, [&] {
+                std::size_t sum = 0;
+
+                for (std::size_t index = 0; index < dispatch_iterations; ++index)
+                {
+                    sum += proxies::visit_known<devirtualize::impl<0>, devirtualize::impl<1>>(
+                        values[index % proxy_count],
+                        [&](const auto& value) { return value.work(index); },
+                        [&](const facade_t& facade) { return facade.work(index); });
+                }
+
+                do_not_optimize(sum);
+            });
+        };
+
+        benchmark.template operator()<proxy_dispatch_static<>>("static skewed dispatch", true);
+        benchmark.template operator()<proxy_dispatch_speculative<proxy_dispatch_static<>>>("static skewed speculative dispatch", true);
+        benchmark_known.template operator()<proxy_dispatch_static<>>("static skewed visit known", true);
+        benchmark.template operator()<proxy_dispatch_static<>>("static uniform dispatch", false);
+        benchmark.template operator()<proxy_dispatch_speculative<proxy_dispatch_static<>>>("static uniform speculative dispatch", false);
+        benchmark.template operator()<proxy_dispatch_dynamic<>>("dynamic skewed dispatch", true);
+        benchmark.template operator()<proxy_dispatch_speculative<proxy_dispatch_dynamic<>>>("dynamic skewed speculative dispatch", true);
+        benchmark_known.template operator()<proxy_dispatch_dynamic<>>("dynamic skewed visit known", true);
+        benchmark.template operator()<proxy_dispatch_dynamic<>>("dynamic uniform dispatch", false);
+        benchmark.template operator()<proxy_dispatch_speculative<proxy_dispatch_dynamic<>>>("dynamic uniform speculative dispatch", false);
+
+#ifdef SPORE_PROXY_INSTRUMENT
+        std::cout << proxies::dispatch_profile_header(proxies::dispatch_snapshot()) << std::endl;
+#endif
+    }
+}
\ No newline at end of file
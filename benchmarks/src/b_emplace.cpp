@@ -0,0 +1,96 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <array>
+
+namespace spore::benchmarks
+{
+    namespace emplace
+    {
+        struct shape_facade : proxy_facade<shape_facade>
+        {
+            std::size_t area() const
+            {
+                constexpr auto func = [](const auto& self) { return self.area(); };
+                return proxies::dispatch<std::size_t>(func, *this);
+            }
+        };
+
+        using shape_proxy = value_proxy<shape_facade>;
+
+        struct facade : proxy_facade<facade>
+        {
+            // the value is constructed by the implementation, then moved into the result
+            shape_proxy make(const std::size_t size) const
+            {
+                constexpr auto func = [](const auto& self, const std::size_t size) { return proxies::make_value<shape_facade>(self.make(size)); };
+                return proxies::dispatch<shape_proxy>(func, *this, size);
+            }
+
+            // the value is constructed in the result
+            shape_proxy emplace(const std::size_t size) const
+            {
+                constexpr auto func = [](const auto& self, const auto slot, const std::size_t size) { return self.emplace(slot, size); };
+                return proxies::dispatch_emplace<shape_proxy>(func, *this, size);
+            }
+        };
+
+        // too large for the inline buffer of a value proxy
+        struct polygon
+        {
+            std::array<std::size_t, 16> sides {};
+
+            explicit polygon(const std::size_t size) noexcept
+            {
+                sides.fill(size);
+            }
+
+            std::size_t area() const
+            {
+                return sides.front() * sides.back();
+            }
+        };
+
+        struct impl
+        {
+            polygon make(const std::size_t size) const
+            {
+                return polygon {size};
+            }
+
+            shape_proxy emplace(const proxy_return_slot<shape_proxy> slot, const std::size_t size) const
+            {
+                return slot.emplace<polygon>(size);
+            }
+        };
+    }
+
+    void run_emplace_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t make_iterations = 10000000;
+
+        const value_proxy<emplace::facade> factory = proxies::make_value<emplace::facade>(emplace::impl {});
+
+        results.emplace_back() = run_benchmark("return by move", [&] {
+            std::size_t sum = 0;
+
+            for (std::size_t index = 0; index < make_iterations; ++index)
+            {
+                sum += factory.make(index).area();
+            }
+
+            do_not_optimize(sum);
+        });
+
+        results.emplace_back() = run_benchmark("return by slot", [&] {
+            std::size_t sum = 0;
+
+            for (std::size_t index = 0; index < make_iterations; ++index)
+            {
+                sum += factory.emplace(index).area();
+            }
+
+            do_not_optimize(sum);
+        });
+    }
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+namespace spore::benchmarks
+{
+    namespace instrument
+    {
+        template <typename dispatch_t>
+        struct facade : proxy_facade<facade<dispatch_t>>
+        {
+            using dispatch_type [[maybe_unused]] = dispatch_t;
+
+            std::size_t read() const
+            {
+                constexpr auto func = [](const auto& self) { return self.read(); };
+                return proxies::dispatch<std::size_t>(func, *this);
+            }
+        };
+
+        struct impl
+        {
+            std::size_t value = 0;
+
+            std::size_t read() const
+            {
+                return value;
+            }
+        };
+    }
+
+    void run_instrument_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t dispatch_iterations = 10000000;
+
+        const auto benchmark = [&]<typename dispatch_t>(const std::string_view name) {
+            using facade_t = instrument::facade<dispatch_t>;
+
+            const value_proxy<facade_t> proxy = proxies::make_value<facade_t>(instrument::impl {});
+
+            results.emplace_back() = run_benchmark(name, [&] {
+                for (std::size_t index = 0; index < dispatch_iterations; ++index)
+                {
+                    std::size_t value = proxy.read();
+                    do_not_optimize(value);
+                }
+            });
+        };
+
+        benchmark.template operator()<proxy_dispatch_static<>>("static dispatch");
+        benchmark.template operator()<proxy_dispatch_instrumented<proxy_dispatch_static<>>>("static instrumented dispatch");
+        benchmark.template operator()<proxy_dispatch_instrumented<proxy_dispatch_static<>, 1024>>("static sampled dispatch");
+        benchmark.template operator()<proxy_dispatch_dynamic<>>("dynamic dispatch");
+        benchmark.template operator()<proxy_dispatch_instrumented<proxy_dispatch_dynamic<>>>("dynamic instrumented dispatch");
+        benchmark.template operator()<proxy_dispatch_instrumented<proxy_dispatch_dynamic<>, 1024>>("dynamic sampled dispatch");
+    }
+}
\ No newline at end of file
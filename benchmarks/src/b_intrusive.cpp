@@ -0,0 +1,85 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+namespace spore::benchmarks
+{
+    namespace intrusive
+    {
+        struct facade : proxy_facade<facade>
+        {
+        };
+
+        struct impl
+        {
+            std::size_t value = 0;
+            std::uint32_t count = 0;
+
+            friend void proxy_intrusive_add_ref(impl& value) noexcept
+            {
+                ++value.count;
+            }
+
+            friend void proxy_intrusive_release(impl& value) noexcept
+            {
+                if (--value.count == 0)
+                {
+                    delete std::addressof(value);
+                }
+            }
+        };
+    }
+
+    void run_intrusive_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t create_iterations = 10000000;
+        constexpr std::size_t copy_iterations = 10000000;
+
+        results.emplace_back() = run_benchmark("shared create", [] {
+            for (std::size_t index = 0; index < create_iterations; ++index)
+            {
+                auto proxy = proxies::make_shared<intrusive::facade>(intrusive::impl {});
+                do_not_optimize(proxy);
+            }
+        });
+
+        results.emplace_back() = run_benchmark("intrusive create", [] {
+            for (std::size_t index = 0; index < create_iterations; ++index)
+            {
+                auto proxy = proxies::make_intrusive<intrusive::facade>(intrusive::impl {});
+                do_not_optimize(proxy);
+            }
+        });
+
+        results.emplace_back() = run_benchmark("intrusive adopt", [] {
+            for (std::size_t index = 0; index < create_iterations; ++index)
+            {
+                auto proxy = proxies::adopt_intrusive<intrusive::facade>(new intrusive::impl {});
+                do_not_optimize(proxy);
+            }
+        });
+
+        {
+            auto proxy = proxies::make_shared<intrusive::facade>(intrusive::impl {});
+
+            results.emplace_back() = run_benchmark("shared copy", [&] {
+                for (std::size_t index = 0; index < copy_iterations; ++index)
+                {
+                    auto copy = proxy;
+                    do_not_optimize(copy);
+                }
+            });
+        }
+
+        {
+            auto proxy = proxies::make_intrusive<intrusive::facade>(intrusive::impl {});
+
+            results.emplace_back() = run_benchmark("intrusive copy", [&] {
+                for (std::size_t index = 0; index < copy_iterations; ++index)
+                {
+                    auto copy = proxy;
+                    do_not_optimize(copy);
+                }
+            });
+        }
+    }
+}
\ No newline at end of file
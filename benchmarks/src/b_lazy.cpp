@@ -0,0 +1,74 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <array>
+
+namespace spore::benchmarks
+{
+    namespace lazy
+    {
+        struct facade : proxy_facade<facade>
+        {
+            std::size_t read() const
+            {
+                constexpr auto func = [](const auto& self) { return self.read(); };
+                return proxies::dispatch<std::size_t>(func, *this);
+            }
+        };
+
+        struct impl
+        {
+            std::array<std::size_t, 64> values {};
+
+            impl(const std::size_t value)
+            {
+                values.fill(value);
+            }
+
+            std::size_t read() const
+            {
+                return values[0];
+            }
+        };
+    }
+
+    void run_lazy_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t proxy_count = 1000000;
+        constexpr std::size_t dispatch_iterations = 10000000;
+
+        const auto benchmark = [&]<typename proxy_t>(const std::string_view name, const auto& make) {
+            std::vector<proxy_t> proxies;
+            proxies.reserve(proxy_count);
+
+            results.emplace_back() = run_benchmark(std::format("{} create", name), [&] {
+                for (std::size_t index = 0; index < proxy_count; ++index)
+                {
+                    proxies.emplace_back(make(index));
+                }
+            });
+
+            const proxy_t& proxy = proxies.front();
+
+            results.emplace_back() = run_benchmark(std::format("{} dispatch", name), [&] {
+                for (std::size_t index = 0; index < dispatch_iterations; ++index)
+                {
+                    std::size_t value = proxy->read();
+                    do_not_optimize(value);
+                }
+            });
+        };
+
+        benchmark.template operator()<unique_proxy<lazy::facade>>("unique", [](const std::size_t index) {
+            return proxies::make_unique<lazy::facade, lazy::impl>(index);
+        });
+
+        benchmark.template operator()<lazy_proxy<lazy::facade>>("lazy", [](const std::size_t index) {
+            return proxies::make_lazy<lazy::facade, lazy::impl>(index);
+        });
+
+        benchmark.template operator()<lazy_proxy_mt<lazy::facade>>("lazy mt", [](const std::size_t index) {
+            return proxies::make_lazy_mt<lazy::facade, lazy::impl>(index);
+        });
+    }
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <array>
+
+namespace spore::benchmarks
+{
+    namespace lifecycle
+    {
+        struct facade : proxy_facade<facade>
+        {
+        };
+
+        struct small_impl
+        {
+            std::size_t value = 0;
+        };
+
+        struct large_impl
+        {
+            std::array<std::size_t, 8> values {};
+        };
+    }
+
+    void run_lifecycle_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t lifecycle_iterations = 10000000;
+
+        const auto benchmark = [&]<typename value_t>(const std::string_view name) {
+            results.emplace_back() = run_benchmark(std::format("value {} create", name), [] {
+                for (std::size_t index = 0; index < lifecycle_iterations; ++index)
+                {
+                    value_proxy<lifecycle::facade> proxy {std::in_place_type<value_t>};
+                    do_not_optimize(proxy);
+                }
+            });
+
+            value_proxy<lifecycle::facade> proxy {std::in_place_type<value_t>};
+
+            results.emplace_back() = run_benchmark(std::format("value {} copy", name), [&] {
+                for (std::size_t index = 0; index < lifecycle_iterations; ++index)
+                {
+                    value_proxy<lifecycle::facade> copy = proxy;
+                    do_not_optimize(copy);
+                }
+            });
+
+            results.emplace_back() = run_benchmark(std::format("value {} move", name), [&] {
+                for (std::size_t index = 0; index < lifecycle_iterations; ++index)
+                {
+                    value_proxy<lifecycle::facade> moved = std::move(proxy);
+                    do_not_optimize(moved);
+                    proxy = std::move(moved);
+                }
+            });
+        };
+
+        benchmark.template operator()<lifecycle::small_impl>("small");
+        benchmark.template operator()<lifecycle::large_impl>("large");
+    }
+}
\ No newline at end of file
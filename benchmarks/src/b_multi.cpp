@@ -0,0 +1,101 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <array>
+#include <utility>
+
+namespace spore::benchmarks
+{
+    namespace multi
+    {
+        inline constexpr std::size_t value_count = 4;
+
+        template <std::size_t index_v>
+        struct shape
+        {
+            std::size_t size = index_v + 1;
+        };
+
+        template <std::size_t first_index_v, std::size_t second_index_v>
+        std::size_t collide(const shape<first_index_v>& first, const shape<second_index_v>& second)
+        {
+            return first.size * (first_index_v + 1) + second.size * (second_index_v + 1);
+        }
+
+        template <typename dispatch_t>
+        struct facade : proxy_facade<facade<dispatch_t>>
+        {
+            using dispatch_type [[maybe_unused]] = dispatch_t;
+
+            // nested dispatch, the first dispatch finds the value of this proxy, then a second one the other's
+            std::size_t collide(const facade& other) const
+            {
+                constexpr auto func = [](const auto& self, const facade& other) { return other.collide_with(self); };
+                return proxies::dispatch<std::size_t>(func, *this, other);
+            }
+
+            template <typename first_t>
+            std::size_t collide_with(const first_t& first) const
+            {
+                constexpr auto func = [](const auto& self, const first_t& first) { return multi::collide(first, self); };
+                return proxies::dispatch<std::size_t>(func, *this, first);
+            }
+        };
+
+        inline constexpr auto collide_func = [](const auto& first, const auto& second) { return multi::collide(first, second); };
+    }
+
+    void run_multi_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t proxy_count = 1024;
+        constexpr std::size_t dispatch_iterations = 10000000;
+
+        const auto benchmark = [&]<typename dispatch_t>(const std::string_view nested_name, const std::string_view multi_name) {
+            using facade_t = multi::facade<dispatch_t>;
+
+            const auto make_proxy = []<std::size_t... indices_v>(std::index_sequence<indices_v...>, const std::size_t index) {
+                constexpr std::array<value_proxy<facade_t> (*)(), sizeof...(indices_v)> makers {
+                    [] { return proxies::make_value<facade_t>(multi::shape<indices_v> {}); }...,
+                };
+
+                return makers[index]();
+            };
+
+            std::vector<value_proxy<facade_t>> values;
+            values.reserve(proxy_count);
+
+            std::uint32_t seed = 0x2545f491;
+
+            for (std::size_t index = 0; index < proxy_count; ++index)
+            {
+                seed = seed * 1664525 + 1013904223;
+                values.emplace_back(make_proxy(std::make_index_sequence<multi::value_count> {}, (seed >> 24) % multi::value_count));
+            }
+
+            results.emplace_back() = run_benchmark(nested_name, [&] {
+                std::size_t sum = 0;
+
+                for (std::size_t index = 0; index < dispatch_iterations; ++index)
+                {
+                    sum += values[index % proxy_count].collide(values[(index * 7 + 3) % proxy_count]);
+                }
+
+                do_not_optimize(sum);
+            });
+
+            results.emplace_back() = run_benchmark(multi_name, [&] {
+                std::size_t sum = 0;
+
+                for (std::size_t index = 0; index < dispatch_iterations; ++index)
+                {
+                    sum += proxies::dispatch_multi<std::size_t>(multi::collide_func, values[index % proxy_count], values[(index * 7 + 3) % proxy_count]);
+                }
+
+                do_not_optimize(sum);
+            });
+        };
+
+        benchmark.template operator()<proxy_dispatch_static<>>("static nested dispatch", "static multi dispatch");
+        benchmark.template operator()<proxy_dispatch_dynamic<>>("dynamic nested dispatch", "dynamic multi dispatch");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+#include "spore/proxy/proxy_range.hpp"
+
+#include <numeric>
+#include <ranges>
+
+namespace spore::benchmarks
+{
+    namespace range
+    {
+        // an iterator erased per element, a dispatch for each end check, dereference and increment
+        struct iterator_facade : proxy_facade<iterator_facade>
+        {
+            bool done() const
+            {
+                constexpr auto func = [](const auto& self) { return self.done(); };
+                return proxies::dispatch<bool>(func, *this);
+            }
+
+            int get() const
+            {
+                constexpr auto func = [](const auto& self) { return self.get(); };
+                return proxies::dispatch<int>(func, *this);
+            }
+
+            void next()
+            {
+                constexpr auto func = [](auto& self) { self.next(); };
+                proxies::dispatch(func, *this);
+            }
+        };
+
+        template <typename range_t>
+        struct iterator_impl
+        {
+            std::ranges::iterator_t<const range_t> it;
+            std::ranges::sentinel_t<const range_t> end;
+
+            bool done() const
+            {
+                return it == end;
+            }
+
+            int get() const
+            {
+                return *it;
+            }
+
+            void next()
+            {
+                ++it;
+            }
+        };
+
+        constexpr auto is_kept = [](const int value) { return value % 3 != 0; };
+        constexpr auto transform = [](const int value) { return value * 2; };
+    }
+
+    void run_range_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t value_count = 1 << 20;
+        constexpr std::size_t range_iterations = 64;
+
+        std::vector<int> values(value_count);
+        std::iota(values.begin(), values.end(), 0);
+
+        const auto benchmark = [&](const std::string_view name, const auto& sum_range) {
+            results.emplace_back() = run_benchmark(name, [&] {
+                std::size_t sum = 0;
+
+                for (std::size_t index = 0; index < range_iterations; ++index)
+                {
+                    ++values[index];
+                    sum += sum_range();
+                }
+
+                // the concrete loops have no side effect otherwise
+                [[maybe_unused]] volatile std::size_t kept = sum;
+            });
+        };
+
+        const auto sum_of = [](auto&& range) {
+            std::size_t sum = 0;
+
+            for (const int value : range)
+            {
+                sum += static_cast<std::size_t>(value);
+            }
+
+            return sum;
+        };
+
+        const auto pipeline_of = [&](auto&& range) { return sum_of(range | std::views::filter(range::is_kept) | std::views::transform(range::transform)); };
+
+        benchmark("ranges sum", [&] { return sum_of(values); });
+        benchmark("erased iterator sum", [&] {
+            unique_proxy<range::iterator_facade> it = proxies::make_unique<range::iterator_facade>(range::iterator_impl<std::vector<int>> {values.cbegin(), values.cend()});
+
+            std::size_t sum = 0;
+
+            for (; not it->done(); it->next())
+            {
+                sum += static_cast<std::size_t>(it->get());
+            }
+
+            return sum;
+        });
+        benchmark("chunked 64 sum", [&] { return sum_of(proxies::make_range<int, 64>(values)); });
+        benchmark("chunked 256 sum", [&] { return sum_of(proxies::make_range<int, 256>(values)); });
+        benchmark("chunked 1024 sum", [&] { return sum_of(proxies::make_range<int, 1024>(values)); });
+
+        benchmark("ranges pipeline", [&] { return pipeline_of(values); });
+        benchmark("chunked 256 pipeline", [&] {
+            proxy_range<int, 256> chunked = proxies::make_range<int, 256>(values);
+            return pipeline_of(chunked);
+        });
+    }
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <memory>
+
+namespace spore::benchmarks
+{
+    namespace relocate
+    {
+        struct facade : proxy_facade<facade>
+        {
+        };
+
+        struct trivial_impl
+        {
+            std::size_t value = 0;
+        };
+
+        struct relocatable_impl
+        {
+            std::unique_ptr<std::size_t> value;
+        };
+
+        struct movable_impl
+        {
+            std::unique_ptr<std::size_t> value;
+        };
+
+        template <typename value_t>
+        SPORE_PROXY_FORCE_INLINE void grow(const std::size_t count)
+        {
+            std::vector<value_proxy<facade>> proxies;
+
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                proxies.emplace_back(std::in_place_type<value_t>);
+            }
+
+            do_not_optimize(proxies);
+        }
+    }
+}
+
+namespace spore
+{
+    template <>
+    struct proxy_trivially_relocatable<benchmarks::relocate::relocatable_impl> : std::true_type
+    {
+    };
+}
+
+namespace spore::benchmarks
+{
+    void run_relocate_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t grow_iterations = 1000;
+        constexpr std::size_t grow_count = 10000;
+
+        const auto benchmark = [&]<typename value_t>(const std::string_view name) {
+            results.emplace_back() = run_benchmark(name, [] {
+                for (std::size_t index = 0; index < grow_iterations; ++index)
+                {
+                    relocate::grow<value_t>(grow_count);
+                }
+            });
+        };
+
+        benchmark.template operator()<relocate::trivial_impl>("vector growth (trivial)");
+        benchmark.template operator()<relocate::relocatable_impl>("vector growth (relocatable)");
+        benchmark.template operator()<relocate::movable_impl>("vector growth (movable)");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace spore::benchmarks
+{
+    namespace replay
+    {
+        // captured mappings and values are folded onto these synthetic ones
+        inline constexpr std::size_t method_count = 4;
+        inline constexpr std::size_t value_count = 32;
+
+        template <typename dispatch_t>
+        struct facade : proxy_facade<facade<dispatch_t>>
+        {
+            using dispatch_type [[maybe_unused]] = dispatch_t;
+
+            template <std::size_t method_v>
+            std::size_t call(const std::size_t value) const
+            {
+                constexpr auto func = [](const auto& self, const std::size_t value) { return self.template call<method_v>(value); };
+                return proxies::dispatch<std::size_t>(func, *this, value);
+            }
+        };
+
+        template <std::size_t index_v>
+        struct impl
+        {
+            template <std::size_t method_v>
+            std::size_t call(const std::size_t value) const
+            {
+                return value * (index_v + method_v + 1) + index_v;
+            }
+        };
+
+        struct step
+        {
+            std::uint32_t method;
+            std::uint32_t value;
+        };
+
+        template <typename proxy_t, typename facade_t, typename value_t>
+        proxy_t make_proxy(value_t& value)
+        {
+            if constexpr (std::is_same_v<proxy_t, value_proxy<facade_t>>)
+            {
+                return proxies::make_value<facade_t>(value);
+            }
+            else if constexpr (std::is_same_v<proxy_t, unique_proxy<facade_t>>)
+            {
+                return proxies::make_unique<facade_t>(value);
+            }
+            else if constexpr (std::is_same_v<proxy_t, shared_proxy<facade_t>>)
+            {
+                return proxies::make_shared<facade_t>(value);
+            }
+            else
+            {
+                return proxies::make_view<facade_t>(value);
+            }
+        }
+
+        template <typename proxy_t>
+        SPORE_PROXY_FORCE_INLINE const auto& facade_of(const proxy_t& proxy)
+        {
+            if constexpr (requires { proxy.operator->(); })
+            {
+                return *proxy;
+            }
+            else
+            {
+                return proxy;
+            }
+        }
+
+        template <std::size_t method_v = 0, typename facade_t>
+        SPORE_PROXY_FORCE_INLINE std::size_t call(const facade_t& facade, const std::size_t method, const std::size_t value)
+        {
+            if constexpr (method_v + 1 < method_count)
+            {
+                if (method != method_v)
+                {
+                    return call<method_v + 1>(facade, method, value);
+                }
+            }
+
+            return facade.template call<method_v>(value);
+        }
+
+        // a skewed synthetic trace, used when no capture is given
+        inline proxy_capture make_capture()
+        {
+            using facade_t = facade<proxy_dispatch_instrumented<proxy_dispatch_dynamic<>>>;
+
+            constexpr std::size_t capture_value_count = 16;
+            constexpr std::size_t capture_iterations = 65536;
+
+            const auto make_proxies = []<std::size_t... indices_v>(std::index_sequence<indices_v...>) {
+                return std::array<value_proxy<facade_t>, sizeof...(indices_v)> {proxies::make_value<facade_t>(impl<indices_v> {})...};
+            };
+
+            const std::array<value_proxy<facade_t>, capture_value_count> values = make_proxies(std::make_index_sequence<capture_value_count> {});
+
+            std::uint32_t seed = 0x2545f491;
+            std::size_t sum = 0;
+
+            proxies::capture_begin();
+
+            for (std::size_t index = 0; index < capture_iterations; ++index)
+            {
+                seed = seed * 1664525 + 1013904223;
+
+                // roughly zipfian, each value is picked about half as often as the one before
+                const std::uint32_t roll = seed >> 8;
+                const std::size_t value_index = std::min<std::size_t>(std::countl_zero(roll | 1) - 8, capture_value_count - 1);
+                const std::size_t method = (seed >> 4) % 3;
+
+                sum += call(facade_of(values[value_index]), method, index);
+            }
+
+            proxies::capture_end();
+
+            do_not_optimize(sum);
+
+            // goes through the binary format, as a real capture would
+            std::stringstream stream;
+            proxies::capture_write(stream, proxies::capture_snapshot());
+            return proxies::capture_read(stream);
+        }
+
+        inline proxy_capture load_capture()
+        {
+            if (const char* path = std::getenv("SPORE_PROXY_REPLAY_TRACE"))
+            {
+                std::ifstream stream {path, std::ios::binary};
+                return proxies::capture_read(stream);
+            }
+
+            return make_capture();
+        }
+
+        // mappings and values are numbered in order of first appearance, across threads, values by the facade of their
+        // mapping and their index
+        inline std::vector<step> make_steps(const proxy_capture& capture)
+        {
+            std::unordered_map<std::uint32_t, std::string_view> facades;
+            std::unordered_map<std::uint32_t, std::uint32_t> methods;
+            std::map<std::pair<std::string_view, std::uint32_t>, std::uint32_t> values;
+            std::vector<step> steps;
+
+            for (const proxy_capture_mapping& mapping : capture.mappings)
+            {
+                facades.emplace(mapping.id, mapping.facade);
+            }
+
+            for (const std::vector<proxy_capture_record>& records : capture.threads)
+            {
+                for (const proxy_capture_record& record : records)
+                {
+                    const std::uint32_t method = methods.try_emplace(record.mapping, static_cast<std::uint32_t>(methods.size())).first->second;
+                    const std::uint32_t value = values.try_emplace(std::pair {facades[record.mapping], record.type_index}, static_cast<std::uint32_t>(values.size())).first->second;
+
+                    steps.push_back(step {
+                        .method = static_cast<std::uint32_t>(method % method_count),
+                        .value = static_cast<std::uint32_t>(value % value_count),
+                    });
+                }
+            }
+
+            return steps;
+        }
+    }
+
+    void run_replay_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t replay_iterations = 10000000;
+
+        const std::vector<replay::step> steps = replay::make_steps(replay::load_capture());
+
+        if (steps.empty())
+        {
+            return;
+        }
+
+        const auto benchmark = [&]<typename dispatch_t, template <typename> typename proxy_t>(const std::string_view name) {
+            using facade_t = replay::facade<dispatch_t>;
+
+            const auto make_values = []<std::size_t... indices_v>(std::index_sequence<indices_v...>) {
+                return std::tuple<replay::impl<indices_v>...> {};
+            };
+
+            auto values = make_values(std::make_index_sequence<replay::value_count> {});
+
+            const std::vector<proxy_t<facade_t>> targets = std::apply(
+                [](auto&... values) {
+                    std::vector<proxy_t<facade_t>> targets;
+                    targets.reserve(sizeof...(values));
+                    (targets.emplace_back(replay::make_proxy<proxy_t<facade_t>, facade_t>(values)), ...);
+                    return targets;
+                },
+                values);
+
+            results.emplace_back() = run_benchmark(name, [&] {
+                std::size_t sum = 0;
+
+                for (std::size_t index = 0; index < replay_iterations; ++index)
+                {
+                    const replay::step& step = steps[index % steps.size()];
+                    sum += replay::call(replay::facade_of(targets[step.value]), step.method, index);
+                }
+
+                do_not_optimize(sum);
+            });
+        };
+
+        benchmark.template operator()<proxy_dispatch_static<>, value_proxy>("static value replay");
+        benchmark.template operator()<proxy_dispatch_static<>, unique_proxy>("static unique replay");
+        benchmark.template operator()<proxy_dispatch_static<>, shared_proxy>("static shared replay");
+        benchmark.template operator()<proxy_dispatch_static<>, view_proxy>("static view replay");
+        benchmark.template operator()<proxy_dispatch_dynamic<>, value_proxy>("dynamic value replay");
+        benchmark.template operator()<proxy_dispatch_dynamic<>, unique_proxy>("dynamic unique replay");
+        benchmark.template operator()<proxy_dispatch_dynamic<>, shared_proxy>("dynamic shared replay");
+        benchmark.template operator()<proxy_dispatch_dynamic<>, view_proxy>("dynamic view replay");
+    }
+}
\ No newline at end of file
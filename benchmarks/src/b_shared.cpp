@@ -0,0 +1,94 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace spore::benchmarks
+{
+    namespace shared
+    {
+        struct facade : proxy_facade<facade>
+        {
+        };
+
+        struct impl
+        {
+            std::size_t value = 0;
+        };
+
+        template <typename proxy_t>
+        SPORE_PROXY_FORCE_INLINE void copy_and_destroy(const proxy_t& proxy, const std::size_t iterations)
+        {
+            for (std::size_t index = 0; index < iterations; ++index)
+            {
+                proxy_t copy = proxy;
+                do_not_optimize(copy);
+            }
+        }
+    }
+
+    void run_shared_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t warm_iterations = 100;
+        constexpr std::size_t copy_iterations = 10000000;
+
+        const std::size_t thread_count = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+        const auto benchmark = [&]<typename proxy_t>(const std::string_view name, const proxy_t& proxy) {
+            shared::copy_and_destroy(proxy, warm_iterations);
+
+            results.emplace_back() = run_benchmark(name, [&] {
+                shared::copy_and_destroy(proxy, copy_iterations);
+            });
+        };
+
+        const auto benchmark_threads = [&]<typename proxy_t>(const std::string_view name, const proxy_t& proxy) {
+            std::vector<std::thread> threads;
+            threads.reserve(thread_count);
+
+            std::atomic<bool> started = false;
+
+            results.emplace_back() = run_benchmark(std::format("{} (x{})", name, thread_count), [&] {
+                for (std::size_t index = 0; index < thread_count; ++index)
+                {
+                    threads.emplace_back([&] {
+                        const proxy_t copy = proxy;
+
+                        while (not started.load(std::memory_order_acquire))
+                        {
+                        }
+
+                        shared::copy_and_destroy(copy, copy_iterations / thread_count);
+                    });
+                }
+
+                started.store(true, std::memory_order_release);
+                std::ranges::for_each(threads, [](std::thread& thread) { thread.join(); });
+            });
+        };
+
+        {
+            auto proxy = proxies::make_shared<shared::facade>(shared::impl {});
+            benchmark("shared copy", proxy);
+        }
+
+        {
+            auto proxy = proxies::make_shared_mt<shared::facade>(shared::impl {});
+            benchmark("shared mt copy", proxy);
+            benchmark_threads("shared mt copy", proxy);
+        }
+
+        {
+            shared_proxy_mt<shared::facade, true> proxy {std::in_place_type<shared::impl>};
+            benchmark("shared mt padded copy", proxy);
+            benchmark_threads("shared mt padded copy", proxy);
+        }
+
+        {
+            auto proxy = proxies::make_shared_biased<shared::facade>(shared::impl {});
+            benchmark("shared biased copy", proxy);
+            benchmark_threads("shared biased copy", proxy);
+        }
+    }
+}
\ No newline at end of file
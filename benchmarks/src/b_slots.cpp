@@ -0,0 +1,90 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <array>
+#include <utility>
+
+namespace spore::benchmarks
+{
+    namespace slots
+    {
+        inline constexpr std::size_t value_count = 8;
+
+        template <typename dispatch_t, bool slots_v>
+        struct facade : proxy_facade<facade<dispatch_t, slots_v>>
+        {
+            using dispatch_type [[maybe_unused]] = dispatch_t;
+
+            static constexpr auto work_func = [](const auto& self, const std::size_t value) { return self.work(value); };
+
+            using inline_slots = std::conditional_t<slots_v, proxy_inline_slots<proxy_inline_slot<decltype(work_func), std::size_t(std::size_t) const>>, proxy_inline_slots<>>;
+
+            std::size_t work(const std::size_t value) const
+            {
+                return proxies::dispatch<std::size_t>(work_func, *this, value);
+            }
+        };
+
+        template <std::size_t index_v>
+        struct impl
+        {
+            std::size_t work(const std::size_t value) const
+            {
+                return value * (index_v + 1) + index_v;
+            }
+        };
+
+        template <typename facade_t>
+        std::vector<value_proxy<facade_t>> make_proxies(const std::size_t count)
+        {
+            const auto make_proxy = [&]<std::size_t... indices_v>(std::index_sequence<indices_v...>, const std::size_t index) {
+                constexpr std::array<value_proxy<facade_t> (*)(), sizeof...(indices_v)> makers {
+                    [] { return proxies::make_value<facade_t>(impl<indices_v> {}); }...,
+                };
+
+                return makers[index]();
+            };
+
+            std::vector<value_proxy<facade_t>> values;
+            values.reserve(count);
+
+            std::uint32_t seed = 0x2545f491;
+
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                seed = seed * 1664525 + 1013904223;
+                values.emplace_back(make_proxy(std::make_index_sequence<value_count> {}, (seed >> 24) % value_count));
+            }
+
+            return values;
+        }
+    }
+
+    void run_slots_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t proxy_count = 65536;
+        constexpr std::size_t dispatch_iterations = 10000000;
+
+        const auto benchmark = [&]<typename dispatch_t, bool slots_v>(const std::string_view name) {
+            using facade_t = slots::facade<dispatch_t, slots_v>;
+
+            const std::vector<value_proxy<facade_t>> values = slots::make_proxies<facade_t>(proxy_count);
+
+            results.emplace_back() = run_benchmark(name, [&] {
+                std::size_t sum = 0;
+
+                for (std::size_t index = 0; index < dispatch_iterations; ++index)
+                {
+                    sum += values[index % proxy_count].work(index);
+                }
+
+                do_not_optimize(sum);
+            });
+        };
+
+        benchmark.template operator()<proxy_dispatch_static<>, false>("static table dispatch");
+        benchmark.template operator()<proxy_dispatch_dynamic<>, false>("dynamic table dispatch");
+        benchmark.template operator()<proxy_dispatch_static<>, true>("static inline slot dispatch");
+        benchmark.template operator()<proxy_dispatch_dynamic<>, true>("dynamic inline slot dispatch");
+    }
+}
\ No newline at end of file
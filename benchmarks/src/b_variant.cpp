@@ -0,0 +1,75 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <array>
+#include <string>
+
+namespace spore::benchmarks
+{
+    namespace variant
+    {
+        struct facade : proxy_facade<facade>
+        {
+        };
+
+        struct key_event
+        {
+            std::uint32_t code = 0;
+            bool pressed = false;
+        };
+
+        struct mouse_event
+        {
+            std::array<float, 2> position {};
+            std::uint32_t buttons = 0;
+        };
+
+        struct text_event
+        {
+            std::string text = "text";
+        };
+    }
+
+    void run_variant_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t event_count = 1024;
+        constexpr std::size_t copy_iterations = 10000;
+
+        const auto benchmark = [&]<typename proxy_t>(const std::string_view name) {
+            std::vector<proxy_t> events;
+            events.reserve(event_count);
+
+            for (std::size_t index = 0; index < event_count; ++index)
+            {
+                switch (index % 4)
+                {
+                    case 0:
+                        events.emplace_back(std::in_place_type<variant::text_event>);
+                        break;
+
+                    case 1:
+                        events.emplace_back(std::in_place_type<variant::mouse_event>);
+                        break;
+
+                    default:
+                        events.emplace_back(std::in_place_type<variant::key_event>);
+                        break;
+                }
+            }
+
+            results.emplace_back() = run_benchmark(std::format("{} events copy", name), [&] {
+                for (std::size_t index = 0; index < copy_iterations; ++index)
+                {
+                    std::vector<proxy_t> copy = events;
+                    do_not_optimize(copy);
+                }
+            });
+        };
+
+        using value_proxy_t = value_proxy<variant::facade>;
+        using variant_proxy_t = variant_proxy<variant::facade, variant::key_event, variant::mouse_event, variant::text_event>;
+
+        benchmark.template operator()<value_proxy_t>("value");
+        benchmark.template operator()<variant_proxy_t>("variant");
+    }
+}
\ No newline at end of file
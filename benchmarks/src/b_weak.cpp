@@ -0,0 +1,88 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
+#include "spore/proxy/proxy.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace spore::benchmarks
+{
+    namespace weak
+    {
+        struct facade : proxy_facade<facade>
+        {
+        };
+
+        struct impl
+        {
+            std::size_t value = 0;
+        };
+
+        template <typename weak_proxy_t>
+        SPORE_PROXY_FORCE_INLINE void lock_and_release(const weak_proxy_t& proxy, const std::size_t iterations)
+        {
+            for (std::size_t index = 0; index < iterations; ++index)
+            {
+                auto locked = proxy.lock();
+                do_not_optimize(locked);
+            }
+        }
+    }
+
+    void run_weak_benchmarks(std::vector<result>& results)
+    {
+        constexpr std::size_t warm_iterations = 100;
+        constexpr std::size_t lock_iterations = 10000000;
+
+        const std::size_t thread_count = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+        const auto benchmark = [&]<typename weak_proxy_t>(const std::string_view name, const weak_proxy_t& proxy) {
+            weak::lock_and_release(proxy, warm_iterations);
+
+            results.emplace_back() = run_benchmark(name, [&] {
+                weak::lock_and_release(proxy, lock_iterations);
+            });
+        };
+
+        const auto benchmark_threads = [&]<typename weak_proxy_t>(const std::string_view name, const weak_proxy_t& proxy) {
+            std::vector<std::thread> threads;
+            threads.reserve(thread_count);
+
+            std::atomic<bool> started = false;
+
+            results.emplace_back() = run_benchmark(std::format("{} (x{})", name, thread_count), [&] {
+                for (std::size_t index = 0; index < thread_count; ++index)
+                {
+                    threads.emplace_back([&] {
+                        const weak_proxy_t copy = proxy;
+
+                        while (not started.load(std::memory_order_acquire))
+                        {
+                        }
+
+                        weak::lock_and_release(copy, lock_iterations / thread_count);
+                    });
+                }
+
+                started.store(true, std::memory_order_release);
+                std::ranges::for_each(threads, [](std::thread& thread) { thread.join(); });
+            });
+        };
+
+        {
+            auto proxy = proxies::make_shared<weak::facade>(weak::impl {});
+            benchmark("weak lock", weak_proxy<weak::facade> {proxy});
+        }
+
+        {
+            auto proxy = proxies::make_shared_mt<weak::facade>(weak::impl {});
+            benchmark("weak mt lock", weak_proxy_mt<weak::facade> {proxy});
+            benchmark_threads("weak mt lock", weak_proxy_mt<weak::facade> {proxy});
+        }
+
+        {
+            shared_proxy_mt<weak::facade, true> proxy {std::in_place_type<weak::impl>};
+            benchmark("weak mt padded lock", weak_proxy_mt<weak::facade, true> {proxy});
+            benchmark_threads("weak mt padded lock", weak_proxy_mt<weak::facade, true> {proxy});
+        }
+    }
+}
\ No newline at end of file
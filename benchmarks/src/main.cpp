@@ -1,3 +1,4 @@
+#include "spore/proxy/benchmarks/b_common.hpp"
 #include "spore/proxy/proxy.hpp"
 
 #include "avask/some.hpp"
@@ -16,50 +17,6 @@
 
 namespace spore::benchmarks
 {
-    struct result
-    {
-        std::string name;
-        std::double_t time;
-    };
-
-    template <typename value_t>
-    SPORE_PROXY_FORCE_INLINE void do_not_optimize(value_t& value)
-    {
-        std::atomic_thread_fence(std::memory_order_seq_cst);
-        (void) value;
-        std::atomic_thread_fence(std::memory_order_seq_cst);
-    }
-
-    void output_results(const std::span<const result> results)
-    {
-        std::cout << std::format("| {0:-^25} | {0:-^10} |", "") << std::endl;
-        std::cout << std::format("| {:<25} | {:>10} |", "Name", "Seconds") << std::endl;
-        std::cout << std::format("| {0:-^25} | {0:-^10} |", "") << std::endl;
-
-        for (const result& result : results)
-        {
-            std::cout << std::format("| {:<25} | {:>10.4f} |", result.name, result.time) << std::endl;
-        }
-
-        std::cout << std::format("| {0:-^25} | {0:-^10} |", "") << std::endl;
-    }
-
-    template <typename func_t>
-    result run_benchmark(const std::string_view name, func_t&& func)
-    {
-        const auto then = std::chrono::steady_clock::now();
-
-        func();
-
-        const auto now = std::chrono::steady_clock::now();
-        const std::chrono::duration<std::double_t> duration = now - then;
-
-        return result {
-            .name = std::string {name},
-            .time = duration.count(),
-        };
-    }
-
     std::size_t do_work(const std::size_t size) noexcept
     {
         std::size_t result = 0;
@@ -383,6 +340,22 @@ int main()
         benchmark.template operator()<work_forward>("spore dynamic (forward)", facade);
     }
 
+    benchmarks::run_shared_benchmarks(results);
+    benchmarks::run_intrusive_benchmarks(results);
+    benchmarks::run_relocate_benchmarks(results);
+    benchmarks::run_lifecycle_benchmarks(results);
+    benchmarks::run_cow_benchmarks(results);
+    benchmarks::run_variant_benchmarks(results);
+    benchmarks::run_lazy_benchmarks(results);
+    benchmarks::run_weak_benchmarks(results);
+    benchmarks::run_instrument_benchmarks(results);
+    benchmarks::run_devirtualize_benchmarks(results);
+    benchmarks::run_replay_benchmarks(results);
+    benchmarks::run_bind_benchmarks(results);
+    benchmarks::run_multi_benchmarks(results);
+    benchmarks::run_slots_benchmarks(results);
+    benchmarks::run_emplace_benchmarks(results);
+    benchmarks::run_range_benchmarks(results);
     benchmarks::output_results(results);
     return 0;
 }
\ No newline at end of file
@@ -1,16 +1,23 @@
 #pragma once
 
 #include "spore/proxy/proxy_base.hpp"
+#include "spore/proxy/proxy_capture.hpp"
 #include "spore/proxy/proxy_concepts.hpp"
 #include "spore/proxy/proxy_conversions.hpp"
+#include "spore/proxy/proxy_counter.hpp"
 #include "spore/proxy/proxy_dispatch.hpp"
 #include "spore/proxy/proxy_facade.hpp"
 #include "spore/proxy/proxy_forward_like.hpp"
+#include "spore/proxy/proxy_instrument.hpp"
+#include "spore/proxy/proxy_registry.hpp"
 #include "spore/proxy/proxy_semantics.hpp"
 #include "spore/proxy/proxy_storage.hpp"
 
 namespace spore
 {
+    template <any_proxy_facade facade_t, typename counter_t, bool padded_v>
+    struct weak_proxy;
+
     template <any_proxy_facade facade_t, any_proxy_storage storage_t, any_proxy_semantics semantics_t>
     struct SPORE_PROXY_ENFORCE_EBCO proxy final : semantics_t, proxy_base
     {
@@ -24,12 +31,18 @@ namespace spore
         template <typename value_t, typename... args_t>
         constexpr explicit proxy(std::in_place_type_t<value_t> type, args_t&&... args)
             noexcept(std::is_nothrow_constructible_v<storage_t, std::in_place_type_t<value_t>, args_t&&...>)
-            : proxy_base(proxies::detail::type_index<facade_t, value_t>()), _storage(type, std::forward<args_t>(args)...)
+            : proxy_base(proxies::detail::type_index<facade_t, proxies::detail::stored_value_t<storage_t, value_t>>(), slot_count),
+              _storage(SPORE_PROXY_INSTRUMENT_FACADE(facade_t, storage_t(type, std::forward<args_t>(args)...)))
         {
+            using stored_value_t = proxies::detail::stored_value_t<storage_t, value_t>;
+
             proxies::detail::add_facade<facade_t>();
-            proxies::detail::add_facade_value_once<facade_t, value_t>();
+            proxies::detail::add_facade_value_once<facade_t, stored_value_t>();
+
+            _ptr = base_ptr();
+            _slots.template resolve<stored_value_t>();
 
-            _ptr = _storage.ptr();
+            assert_slots_layout();
         }
 
         template <typename other_proxy_t>
@@ -40,8 +53,10 @@ namespace spore
                      proxy_conversion<proxy, std::decay_t<other_proxy_t>>::can_copy or
                      proxy_conversion<proxy, std::decay_t<other_proxy_t>>::can_move))
             // clang-format on
-            : proxy_base(other.type_index())
+            : proxy_base(invalid_type_index, slot_count)
         {
+            SPORE_PROXY_INSTRUMENT_FACADE_SCOPE(facade_t);
+
             using decay_other_proxy_t = std::decay_t<other_proxy_t>;
             using other_facade_t = typename decay_other_proxy_t::facade_type;
             using other_storage_t = typename decay_other_proxy_t::storage_type;
@@ -54,6 +69,8 @@ namespace spore
             constexpr bool is_proxy_movable = proxies::detail::is_proxy_semantics_movable<
                 decltype(proxies::detail::forward_like<other_proxy_t&&>(std::declval<other_semantics_t>()))>::value;
 
+            _type_index = converted_type_index(other);
+
             if constexpr (conversion_t::can_move and is_proxy_movable)
             {
                 if constexpr (std::is_const_v<std::remove_reference_t<other_proxy_t>>)
@@ -72,24 +89,30 @@ namespace spore
                 _storage = storage_t {other._storage};
             }
 
-            _ptr = _storage.ptr();
+            _ptr = base_ptr();
+            _slots.resolve(_type_index);
+
+            assert_slots_layout();
         }
 
         constexpr proxy(const proxy& other)
             noexcept(std::is_nothrow_copy_constructible_v<storage_t>)
             requires(std::is_copy_constructible_v<storage_t>)
-            : proxy_base(other.type_index()), _storage(other._storage)
+            : proxy_base(other.type_index(), slot_count), _slots(other._slots), _storage(SPORE_PROXY_INSTRUMENT_FACADE(facade_t, storage_t(other._storage)))
         {
-            _ptr = _storage.ptr();
+            _ptr = base_ptr();
         }
 
         constexpr proxy& operator=(const proxy& other)
             noexcept(std::is_nothrow_copy_assignable_v<storage_t>)
             requires(std::is_copy_assignable_v<storage_t>)
         {
+            SPORE_PROXY_INSTRUMENT_FACADE_SCOPE(facade_t);
+
             _storage = other._storage;
             _type_index = other._type_index;
-            _ptr = _storage.ptr();
+            _slots = other._slots;
+            _ptr = base_ptr();
 
             return *this;
         }
@@ -97,30 +120,136 @@ namespace spore
         constexpr proxy(proxy&& other)
             noexcept(std::is_nothrow_move_constructible_v<storage_t>)
             requires(std::is_move_constructible_v<storage_t>)
-            : proxy_base(other.type_index()), _storage(std::move(other._storage))
+            : proxy_base(other.type_index(), slot_count), _slots(other._slots), _storage(SPORE_PROXY_INSTRUMENT_FACADE(facade_t, storage_t(std::move(other._storage))))
         {
-            _ptr = _storage.ptr();
+            _ptr = base_ptr();
 
             other._ptr = nullptr;
-            other._type_index = std::numeric_limits<std::uint32_t>::max();
+            other._type_index = invalid_type_index;
         }
 
         constexpr proxy& operator=(proxy&& other)
             noexcept(std::is_nothrow_move_assignable_v<storage_t>)
             requires(std::is_move_assignable_v<storage_t>)
         {
+            SPORE_PROXY_INSTRUMENT_FACADE_SCOPE(facade_t);
+
             std::swap(_storage, other._storage);
             std::swap(_type_index, other._type_index);
-            std::swap(_ptr, other._ptr);
+            std::swap(_slots, other._slots);
+
+            // inline storages swap their values, not their addresses
+            _ptr = base_ptr();
+            other._ptr = other.base_ptr();
 
             return *this;
         }
 
+        // the value, or nullptr until a lazy storage constructs it
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE void* ptr() noexcept
+        {
+            return value_ptr();
+        }
+
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE const void* ptr() const noexcept
+        {
+            return value_ptr();
+        }
+
+#ifdef SPORE_PROXY_INSTRUMENT
+        ~proxy() noexcept
+        {
+            SPORE_PROXY_INSTRUMENT_FACADE_SCOPE(facade_t);
+
+            _storage.reset();
+        }
+#endif
+
       private:
         template <any_proxy proxy_t, any_proxy other_proxy_t>
         friend struct proxy_conversion;
 
+        template <any_proxy_facade other_facade_t, typename counter_t, bool padded_v>
+        friend struct weak_proxy;
+
+        // takes over a storage holding a value that was already added to the facade at its index, e.g. by a locked weak
+        // proxy
+        constexpr proxy(proxy_adopt_t, storage_t&& storage, const std::uint32_t type_index) noexcept
+            : proxy_base(storage.type_info() != nullptr ? type_index : invalid_type_index, slot_count), _storage(std::move(storage))
+        {
+            static_assert(not proxies::detail::hooked_storage<storage_t>);
+
+            _ptr = base_ptr();
+            _slots.resolve(_type_index);
+        }
+
+        using slot_table_type = proxies::detail::inline_slot_table<facade_t>;
+
+        static constexpr auto slot_count = static_cast<std::uint8_t>(slot_table_type::size);
+
+        // dispatch finds the inline slots right after the proxy base
+        static_assert(slot_count == 0 or (alignof(slot_table_type) <= alignof(proxy_base) and sizeof(proxy_base) % alignof(slot_table_type) == 0));
+
+        // empty unless the facade declares inline slots
+        SPORE_PROXY_ENFORCE_NO_UNIQUE_ADDRESS slot_table_type _slots;
         storage_t _storage;
+
+        // the pointer dispatched to, a hooked storage is dispatched to itself so that its hook runs first
+        [[nodiscard]] void* base_ptr() const noexcept
+        {
+            if constexpr (proxies::detail::hooked_storage<storage_t>)
+            {
+                return const_cast<storage_t*>(std::addressof(_storage));
+            }
+            else
+            {
+                return _storage.ptr();
+            }
+        }
+
+        [[nodiscard]] void* value_ptr() const noexcept
+        {
+            if constexpr (proxies::detail::hooked_storage<storage_t>)
+            {
+                return _storage.value_ptr();
+            }
+            else
+            {
+                return _ptr;
+            }
+        }
+
+        // a proxy of a hooked storage registers its value with its storage, so the index of a value converted from or to
+        // one is found through a dispatch to the other proxy
+        template <any_proxy other_proxy_t>
+        static std::uint32_t converted_type_index(const other_proxy_t& other) SPORE_PROXY_THROW_SPEC
+        {
+            using other_facade_t = typename other_proxy_t::facade_type;
+            using other_storage_t = typename other_proxy_t::storage_type;
+
+            if constexpr (std::is_same_v<proxies::detail::stored_value_t<storage_t, void>, proxies::detail::stored_value_t<other_storage_t, void>>)
+            {
+                return other.type_index();
+            }
+            else
+            {
+                if (other.type_index() == invalid_type_index)
+                {
+                    return invalid_type_index;
+                }
+
+                const auto& other_facade = reinterpret_cast<const other_facade_t&>(static_cast<const proxy_base&>(other));
+                return proxies::detail::dispatch_impl<std::uint32_t>(proxies::detail::dispatch_converted_type_index<facade_t, storage_t> {}, other_facade);
+            }
+        }
+
+        void assert_slots_layout() const noexcept
+        {
+            if constexpr (slot_count != 0)
+            {
+                SPORE_PROXY_ASSERT(static_cast<const void*>(std::addressof(_slots)) == reinterpret_cast<const std::byte*>(static_cast<const proxy_base*>(this)) + sizeof(proxy_base));
+            }
+        }
     };
 
     namespace proxies::detail
@@ -134,17 +263,116 @@ namespace spore
     template <any_proxy_facade facade_t, typename value_t>
     using inline_proxy = proxy<facade_t, proxy_storage_inline<value_t>, proxy_value_semantics<facade_t>>;
 
+    template <any_proxy_facade facade_t, typename... values_t>
+    using variant_proxy = proxy<facade_t, proxy_storage_variant<values_t...>, proxy_value_semantics<facade_t>>;
+
     template <any_proxy_facade facade_t>
     using value_proxy = proxy<facade_t, proxy_storage_chain<proxy_storage_sbo<16>, proxy_storage_value>, proxy_value_semantics<facade_t>>;
 
+    namespace proxies::detail
+    {
+        template <typename facade_t>
+        struct facade_value_types
+        {
+            using type = proxy_value_types<>;
+        };
+
+        template <typename facade_t>
+            requires requires { typename facade_t::value_types; }
+        struct facade_value_types<facade_t>
+        {
+            using type = typename facade_t::value_types;
+        };
+
+        template <typename facade_t, typename... values_t>
+        using auto_value_types_t = typename concat_value_types<typename facade_value_types<facade_t>::type, proxy_value_types<values_t...>>::type;
+
+        template <typename storage_t, typename... values_t>
+        struct spilled_value_types;
+
+        template <typename storage_t, typename... values_t>
+        struct spilled_value_types<storage_t, proxy_value_types<values_t...>>
+            : concat_value_types<proxy_value_types<>, std::conditional_t<storage_t::template is_inline<values_t>(), proxy_value_types<>, proxy_value_types<values_t>>...>
+        {
+        };
+    }
+
+    // value proxy whose inline buffer fits the facade's value_types and the given values
+    template <any_proxy_facade facade_t, typename... values_t>
+    using value_proxy_auto = proxy<
+        facade_t,
+        proxy_storage_chain<typename proxies::detail::sbo_for_value_types<proxies::detail::auto_value_types_t<facade_t, values_t...>>::type, proxy_storage_value>,
+        proxy_value_semantics<facade_t>>;
+
     template <any_proxy_facade facade_t>
     using unique_proxy = proxy<facade_t, proxy_storage_unique, proxy_pointer_semantics<facade_t>>;
 
+    template <any_proxy_facade facade_t>
+    using lazy_proxy = proxy<facade_t, proxy_storage_lazy<false>, proxy_pointer_semantics<facade_t>>;
+
+    template <any_proxy_facade facade_t>
+    using lazy_proxy_mt = proxy<facade_t, proxy_storage_lazy<true>, proxy_pointer_semantics<facade_t>>;
+
+    template <any_proxy_facade facade_t>
+    using external_proxy = proxy<facade_t, proxy_storage_external, proxy_pointer_semantics<facade_t>>;
+
     template <any_proxy_facade facade_t>
     using shared_proxy = proxy<facade_t, proxy_storage_shared<std::uint32_t>, proxy_pointer_semantics<facade_t>>;
 
+    template <any_proxy_facade facade_t, bool padded_v = false>
+    using shared_proxy_mt = proxy<facade_t, proxy_storage_shared<std::atomic<std::uint32_t>, padded_v>, proxy_pointer_semantics<facade_t>>;
+
     template <any_proxy_facade facade_t>
-    using shared_proxy_mt = proxy<facade_t, proxy_storage_shared<std::atomic<std::uint32_t>>, proxy_pointer_semantics<facade_t>>;
+    using shared_proxy_biased = proxy<facade_t, proxy_storage_shared<proxy_counter_biased>, proxy_pointer_semantics<facade_t>>;
+
+    // observes the value of a shared proxy without keeping it alive, the value is destroyed with its last shared proxy
+    template <any_proxy_facade facade_t, typename counter_t = std::uint32_t, bool padded_v = false>
+    struct weak_proxy
+    {
+        using facade_type = facade_t;
+        using shared_proxy_type = proxy<facade_t, proxy_storage_shared<counter_t, padded_v>, proxy_pointer_semantics<facade_t>>;
+
+        weak_proxy() = default;
+
+        weak_proxy(const shared_proxy_type& proxy) noexcept
+            : _storage(proxy._storage),
+              _type_index(proxy.type_index())
+        {
+        }
+
+        // an empty shared proxy once the value is destroyed
+        [[nodiscard]] shared_proxy_type lock() const noexcept
+        {
+            return shared_proxy_type {proxy_adopt, _storage.lock(), _type_index};
+        }
+
+        [[nodiscard]] bool expired() const noexcept
+        {
+            return _storage.expired();
+        }
+
+        void reset() noexcept
+        {
+            _storage.reset();
+            _type_index = proxy_base::invalid_type_index;
+        }
+
+      private:
+        typename proxy_storage_shared<counter_t, padded_v>::weak_storage _storage;
+        std::uint32_t _type_index = proxy_base::invalid_type_index;
+    };
+
+    template <any_proxy_facade facade_t, bool padded_v = false>
+    using weak_proxy_mt = weak_proxy<facade_t, std::atomic<std::uint32_t>, padded_v>;
+
+    template <any_proxy_facade facade_t>
+    using shared_ptr_proxy = proxy<facade_t, proxy_storage_shared_ptr, proxy_pointer_semantics<facade_t>>;
+
+    template <any_proxy_facade facade_t>
+    using cow_proxy = proxy<facade_t, proxy_storage_cow, proxy_value_semantics<facade_t>>;
+
+    template <any_proxy_facade facade_t>
+    using intrusive_proxy = proxy<facade_t, proxy_storage_intrusive, proxy_pointer_semantics<facade_t>>;
 
     template <typename forward_facade_t>
         requires(any_proxy_facade<std::remove_const_t<std::remove_volatile_t<forward_facade_t>>>)
@@ -156,6 +384,13 @@ namespace spore
 
     namespace proxies
     {
+        // the values that a value proxy would store on the heap, among the facade's value_types and the given values,
+        // a static assert against an empty list reports them at compile time
+        template <any_proxy proxy_t, typename... values_t>
+        using spilled_value_types_t = typename proxies::detail::spilled_value_types<
+            typename proxy_t::storage_type,
+            proxies::detail::auto_value_types_t<typename proxy_t::facade_type, values_t...>>::type;
+
         template <any_proxy_facade facade_t, typename value_t, typename... args_t>
         constexpr inline_proxy<facade_t, value_t> make_inline(args_t&&... args)
             noexcept(std::is_nothrow_constructible_v<inline_proxy<facade_t, value_t>, std::in_place_type_t<value_t>, args_t&&...>)
@@ -170,6 +405,13 @@ namespace spore
             return inline_proxy<facade_t, std::decay_t<value_t>> {std::in_place_type<std::decay_t<value_t>>, std::forward<value_t>(value)};
         }
 
+        template <any_proxy_facade facade_t, typename... values_t, typename value_t>
+        constexpr variant_proxy<facade_t, values_t...> make_variant(value_t&& value)
+            noexcept(std::is_nothrow_constructible_v<variant_proxy<facade_t, values_t...>, std::in_place_type_t<std::decay_t<value_t>>, value_t&&>)
+        {
+            return variant_proxy<facade_t, values_t...> {std::in_place_type<std::decay_t<value_t>>, std::forward<value_t>(value)};
+        }
+
         template <any_proxy_facade facade_t, typename value_t, typename... args_t>
         constexpr value_proxy<facade_t> make_value(args_t&&... args)
             noexcept(std::is_nothrow_constructible_v<value_proxy<facade_t>, std::in_place_type_t<value_t>, args_t&&...>)
@@ -198,6 +440,40 @@ namespace spore
             return unique_proxy<facade_t> {std::in_place_type<std::decay_t<value_t>>, std::forward<value_t>(value)};
         }
 
+        template <any_proxy_facade facade_t, typename value_t, typename deleter_t>
+        constexpr unique_proxy<facade_t> adopt_unique(std::unique_ptr<value_t, deleter_t> value) noexcept
+        {
+            return unique_proxy<facade_t> {std::in_place_type<value_t>, proxy_adopt, std::move(value)};
+        }
+
+        template <any_proxy_facade facade_t, typename value_t, typename... args_t>
+        constexpr lazy_proxy<facade_t> make_lazy(args_t&&... args)
+            noexcept(std::is_nothrow_constructible_v<lazy_proxy<facade_t>, std::in_place_type_t<value_t>, args_t&&...>)
+        {
+            return lazy_proxy<facade_t> {std::in_place_type<value_t>, std::forward<args_t>(args)...};
+        }
+
+        template <any_proxy_facade facade_t, typename value_t, typename... args_t>
+        constexpr lazy_proxy_mt<facade_t> make_lazy_mt(args_t&&... args)
+            noexcept(std::is_nothrow_constructible_v<lazy_proxy_mt<facade_t>, std::in_place_type_t<value_t>, args_t&&...>)
+        {
+            return lazy_proxy_mt<facade_t> {std::in_place_type<value_t>, std::forward<args_t>(args)...};
+        }
+
+        template <any_proxy_facade facade_t, typename value_t, typename... args_t>
+        constexpr external_proxy<facade_t> make_external(const std::span<std::byte> buffer, args_t&&... args)
+            noexcept(std::is_nothrow_constructible_v<external_proxy<facade_t>, std::in_place_type_t<value_t>, std::span<std::byte>, args_t&&...>)
+        {
+            return external_proxy<facade_t> {std::in_place_type<value_t>, buffer, std::forward<args_t>(args)...};
+        }
+
+        template <any_proxy_facade facade_t, typename value_t>
+        constexpr external_proxy<facade_t> make_external(const std::span<std::byte> buffer, value_t&& value)
+            noexcept(std::is_nothrow_constructible_v<external_proxy<facade_t>, std::in_place_type_t<std::decay_t<value_t>>, std::span<std::byte>, value_t&&>)
+        {
+            return external_proxy<facade_t> {std::in_place_type<std::decay_t<value_t>>, buffer, std::forward<value_t>(value)};
+        }
+
         template <any_proxy_facade facade_t, typename value_t, typename... args_t>
         constexpr shared_proxy<facade_t> make_shared(args_t&&... args)
             noexcept(std::is_nothrow_constructible_v<shared_proxy<facade_t>, std::in_place_type_t<value_t>, args_t&&...>)
@@ -212,6 +488,12 @@ namespace spore
             return shared_proxy<facade_t> {std::in_place_type<std::decay_t<value_t>>, std::forward<value_t>(value)};
         }
 
+        template <any_proxy_facade facade_t, typename value_t>
+        constexpr shared_ptr_proxy<facade_t> adopt_shared(std::shared_ptr<value_t> value) noexcept
+        {
+            return shared_ptr_proxy<facade_t> {std::in_place_type<value_t>, proxy_adopt, std::move(value)};
+        }
+
         template <any_proxy_facade facade_t, typename value_t, typename... args_t>
         constexpr shared_proxy_mt<facade_t> make_shared_mt(args_t&&... args)
             noexcept(std::is_nothrow_constructible_v<shared_proxy<facade_t>, std::in_place_type_t<value_t>, args_t&&...>)
@@ -226,6 +508,54 @@ namespace spore
             return shared_proxy_mt<facade_t> {std::in_place_type<std::decay_t<value_t>>, std::forward<value_t>(value)};
         }
 
+        template <any_proxy_facade facade_t, typename value_t, typename... args_t>
+        constexpr shared_proxy_biased<facade_t> make_shared_biased(args_t&&... args)
+            noexcept(std::is_nothrow_constructible_v<shared_proxy_biased<facade_t>, std::in_place_type_t<value_t>, args_t&&...>)
+        {
+            return shared_proxy_biased<facade_t> {std::in_place_type<value_t>, std::forward<args_t>(args)...};
+        }
+
+        template <any_proxy_facade facade_t, typename value_t>
+        constexpr shared_proxy_biased<facade_t> make_shared_biased(value_t&& value)
+            noexcept(std::is_nothrow_constructible_v<shared_proxy_biased<facade_t>, std::in_place_type_t<std::decay_t<value_t>>, value_t&&>)
+        {
+            return shared_proxy_biased<facade_t> {std::in_place_type<std::decay_t<value_t>>, std::forward<value_t>(value)};
+        }
+
+        template <any_proxy_facade facade_t, typename value_t, typename... args_t>
+        constexpr cow_proxy<facade_t> make_cow(args_t&&... args)
+            noexcept(std::is_nothrow_constructible_v<cow_proxy<facade_t>, std::in_place_type_t<value_t>, args_t&&...>)
+        {
+            return cow_proxy<facade_t> {std::in_place_type<value_t>, std::forward<args_t>(args)...};
+        }
+
+        template <any_proxy_facade facade_t, typename value_t>
+        constexpr cow_proxy<facade_t> make_cow(value_t&& value)
+            noexcept(std::is_nothrow_constructible_v<cow_proxy<facade_t>, std::in_place_type_t<std::decay_t<value_t>>, value_t&&>)
+        {
+            return cow_proxy<facade_t> {std::in_place_type<std::decay_t<value_t>>, std::forward<value_t>(value)};
+        }
+
+        template <any_proxy_facade facade_t, typename value_t, typename... args_t>
+        constexpr intrusive_proxy<facade_t> make_intrusive(args_t&&... args)
+            noexcept(std::is_nothrow_constructible_v<intrusive_proxy<facade_t>, std::in_place_type_t<value_t>, args_t&&...>)
+        {
+            return intrusive_proxy<facade_t> {std::in_place_type<value_t>, std::forward<args_t>(args)...};
+        }
+
+        template <any_proxy_facade facade_t, typename value_t>
+        constexpr intrusive_proxy<facade_t> make_intrusive(value_t&& value)
+            noexcept(std::is_nothrow_constructible_v<intrusive_proxy<facade_t>, std::in_place_type_t<std::decay_t<value_t>>, value_t&&>)
+        {
+            return intrusive_proxy<facade_t> {std::in_place_type<std::decay_t<value_t>>, std::forward<value_t>(value)};
+        }
+
+        template <any_proxy_facade facade_t, any_proxy_intrusive value_t>
+        constexpr intrusive_proxy<facade_t> adopt_intrusive(value_t* value) noexcept
+        {
+            return intrusive_proxy<facade_t> {std::in_place_type<value_t>, proxy_adopt, value};
+        }
+
         template <any_proxy_facade facade_t, typename value_t>
         constexpr view_proxy<facade_t> make_view(value_t& value)
             noexcept(std::is_nothrow_constructible_v<view_proxy<facade_t>, std::in_place_type_t<std::decay_t<value_t>>, value_t&>)
@@ -4,21 +4,24 @@
 
 #include <cstdint>
 #include <limits>
-#include <optional>
 
 namespace spore
 {
     struct proxy_base
     {
+        static constexpr std::uint32_t invalid_type_index = std::numeric_limits<std::uint32_t>::max();
+
         proxy_base() noexcept
             : _ptr(nullptr),
-              _type_index(std::nullopt)
+              _type_index(invalid_type_index),
+              _slot_count(0)
         {
         }
 
-        explicit proxy_base(const std::uint32_t type_index) noexcept
+        explicit proxy_base(const std::uint32_t type_index, const std::uint8_t slot_count = 0) noexcept
             : _ptr(nullptr),
-              _type_index(type_index)
+              _type_index(type_index),
+              _slot_count(slot_count)
         {
         }
 
@@ -34,11 +37,19 @@ namespace spore
 
         [[nodiscard]] SPORE_PROXY_FORCE_INLINE std::uint32_t type_index() const noexcept
         {
-            return _type_index.value();
+            return _type_index;
+        }
+
+        // inline dispatch slots directly follow the proxy base
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE std::uint8_t slot_count() const noexcept
+        {
+            return _slot_count;
         }
 
       protected:
+        // the value, or the storage of a hooked storage, see proxies::detail::hooked_storage
         void* _ptr;
-        std::optional<std::uint32_t> _type_index;
+        std::uint32_t _type_index;
+        std::uint8_t _slot_count;
     };
 }
\ No newline at end of file
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "spore/proxy/proxy_instrument.hpp"
+#include "spore/proxy/proxy_macros.hpp"
+
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace spore
+{
+    namespace proxies::detail
+    {
+        // little-endian, each string is prefixed by its size:
+        //   magic version
+        //   mapping count, (id facade name)...
+        //   type count, (mapping type_index name)...
+        //   thread count, (record count (mapping type_index)...)...
+        inline constexpr std::uint32_t capture_magic = 0x43585053;
+        inline constexpr std::uint32_t capture_version = 2;
+
+        template <typename value_t>
+        void capture_put(std::ostream& stream, const value_t value)
+        {
+            for (std::size_t index = 0; index < sizeof(value_t); ++index)
+            {
+                stream.put(static_cast<char>(static_cast<std::uint64_t>(value) >> (index * 8) & 0xff));
+            }
+        }
+
+        inline void capture_put(std::ostream& stream, const std::string& value)
+        {
+            capture_put(stream, static_cast<std::uint32_t>(value.size()));
+            stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+        }
+
+        template <typename value_t>
+        [[nodiscard]] value_t capture_get(std::istream& stream) SPORE_PROXY_THROW_SPEC
+        {
+            std::uint64_t value = 0;
+
+            for (std::size_t index = 0; index < sizeof(value_t); ++index)
+            {
+                value |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(stream.get())) << (index * 8);
+            }
+
+            if (not stream)
+            {
+                SPORE_PROXY_THROW("truncated capture");
+            }
+
+            return static_cast<value_t>(value);
+        }
+
+        // the bytes left in the stream, or no limit if it cannot seek
+        [[nodiscard]] inline std::uint64_t capture_remaining(std::istream& stream)
+        {
+            const std::istream::pos_type position = stream.tellg();
+
+            if (position == std::istream::pos_type(-1))
+            {
+                return std::numeric_limits<std::uint64_t>::max();
+            }
+
+            stream.seekg(0, std::ios::end);
+            const std::istream::pos_type end = stream.tellg();
+            stream.seekg(position);
+
+            return end != std::istream::pos_type(-1) and end >= position ? static_cast<std::uint64_t>(end - position) : 0;
+        }
+
+        // reads a count of entries of at least min_size bytes each, a count that doesn't fit in the rest of the stream
+        // throws before anything is allocated for it
+        template <typename count_t>
+        [[nodiscard]] std::size_t capture_get_count(std::istream& stream, const std::size_t min_size) SPORE_PROXY_THROW_SPEC
+        {
+            const auto count = static_cast<std::uint64_t>(capture_get<count_t>(stream));
+
+            if (count > capture_remaining(stream) / min_size)
+            {
+                SPORE_PROXY_THROW("truncated capture");
+            }
+
+            return static_cast<std::size_t>(count);
+        }
+
+        [[nodiscard]] inline std::string capture_get_string(std::istream& stream) SPORE_PROXY_THROW_SPEC
+        {
+            std::string value(capture_get_count<std::uint32_t>(stream, 1), '\0');
+            stream.read(value.data(), static_cast<std::streamsize>(value.size()));
+
+            if (not stream)
+            {
+                SPORE_PROXY_THROW("truncated capture");
+            }
+
+            return value;
+        }
+    }
+
+    namespace proxies
+    {
+        inline void capture_write(std::ostream& stream, const proxy_capture& capture)
+        {
+            using namespace proxies::detail;
+
+            capture_put(stream, capture_magic);
+            capture_put(stream, capture_version);
+
+            capture_put(stream, static_cast<std::uint32_t>(capture.mappings.size()));
+
+            for (const proxy_capture_mapping& mapping : capture.mappings)
+            {
+                capture_put(stream, mapping.id);
+                capture_put(stream, mapping.facade);
+                capture_put(stream, mapping.name);
+            }
+
+            capture_put(stream, static_cast<std::uint32_t>(capture.types.size()));
+
+            for (const proxy_capture_type& type : capture.types)
+            {
+                capture_put(stream, type.mapping);
+                capture_put(stream, type.type_index);
+                capture_put(stream, type.name);
+            }
+
+            capture_put(stream, static_cast<std::uint32_t>(capture.threads.size()));
+
+            for (const std::vector<proxy_capture_record>& records : capture.threads)
+            {
+                capture_put(stream, static_cast<std::uint64_t>(records.size()));
+
+                for (const proxy_capture_record& record : records)
+                {
+                    capture_put(stream, record.mapping);
+                    capture_put(stream, record.type_index);
+                }
+            }
+        }
+
+        [[nodiscard]] inline proxy_capture capture_read(std::istream& stream) SPORE_PROXY_THROW_SPEC
+        {
+            using namespace proxies::detail;
+
+            if (capture_get<std::uint32_t>(stream) != capture_magic or capture_get<std::uint32_t>(stream) != capture_version)
+            {
+                SPORE_PROXY_THROW("not a capture");
+            }
+
+            proxy_capture capture;
+
+            // ids and string sizes, each entry is at least as large
+            capture.mappings.resize(capture_get_count<std::uint32_t>(stream, 3 * sizeof(std::uint32_t)));
+
+            for (proxy_capture_mapping& mapping : capture.mappings)
+            {
+                mapping.id = capture_get<std::uint32_t>(stream);
+                mapping.facade = capture_get_string(stream);
+                mapping.name = capture_get_string(stream);
+            }
+
+            capture.types.resize(capture_get_count<std::uint32_t>(stream, 3 * sizeof(std::uint32_t)));
+
+            for (proxy_capture_type& type : capture.types)
+            {
+                type.mapping = capture_get<std::uint32_t>(stream);
+                type.type_index = capture_get<std::uint32_t>(stream);
+                type.name = capture_get_string(stream);
+            }
+
+            capture.threads.resize(capture_get_count<std::uint32_t>(stream, sizeof(std::uint64_t)));
+
+            for (std::vector<proxy_capture_record>& records : capture.threads)
+            {
+                records.resize(capture_get_count<std::uint64_t>(stream, 2 * sizeof(std::uint32_t)));
+
+                for (proxy_capture_record& record : records)
+                {
+                    record.mapping = capture_get<std::uint32_t>(stream);
+                    record.type_index = capture_get<std::uint32_t>(stream);
+                }
+            }
+
+            return capture;
+        }
+    }
+}
\ No newline at end of file
@@ -17,6 +17,13 @@ namespace spore
             { storage.reset() } -> std::same_as<void>;
         };
 
+    template <typename value_t>
+    concept any_proxy_intrusive =
+        requires(value_t& value) {
+            { proxy_intrusive_add_ref(value) } noexcept -> std::same_as<void>;
+            { proxy_intrusive_release(value) } noexcept -> std::same_as<void>;
+        };
+
     template <typename facade_t, typename... facades_t>
     struct proxy_facade;
 
@@ -0,0 +1,302 @@
+#pragma once
+
+#include "spore/proxy/proxy_macros.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace spore
+{
+    struct proxy_counter_biased;
+
+    namespace proxies::detail
+    {
+        template <typename counter_t>
+        struct counter_traits
+        {
+            using dispose_type = void (*)(counter_t&) noexcept;
+
+            SPORE_PROXY_FORCE_INLINE static void init(counter_t& counter, dispose_type) noexcept
+            {
+                counter = 1;
+            }
+
+            SPORE_PROXY_FORCE_INLINE static void increment(counter_t& counter) noexcept
+            {
+                ++counter;
+            }
+
+            [[nodiscard]] SPORE_PROXY_FORCE_INLINE static bool decrement(counter_t& counter) noexcept
+            {
+                return --counter == 0;
+            }
+        };
+
+        struct biased_queue
+        {
+            std::atomic<proxy_counter_biased*> head = nullptr;
+            std::uint64_t id = 0;
+
+            biased_queue() noexcept;
+            ~biased_queue() noexcept;
+
+            biased_queue(const biased_queue&) = delete;
+            biased_queue& operator=(const biased_queue&) = delete;
+
+            void push(proxy_counter_biased& counter) noexcept;
+            void drain() noexcept;
+
+            SPORE_PROXY_FORCE_INLINE void drain_if_pending() noexcept
+            {
+                if (head.load(std::memory_order_relaxed) != nullptr) [[unlikely]]
+                {
+                    drain();
+                }
+            }
+
+            static std::mutex& registry_mutex() noexcept
+            {
+                static std::mutex mutex;
+                return mutex;
+            }
+
+            // queues by id, ids are assigned under the registry mutex and never reused, unlike the address of the queue of
+            // an exited thread, so that a counter of an exited thread is never taken for one of a later thread
+            static std::unordered_map<std::uint64_t, biased_queue*>& registry() noexcept
+            {
+                static std::unordered_map<std::uint64_t, biased_queue*> queues;
+                return queues;
+            }
+
+            static std::uint64_t& last_id() noexcept
+            {
+                static std::uint64_t id = 0;
+                return id;
+            }
+
+            static biased_queue& local() noexcept
+            {
+                static thread_local biased_queue queue;
+                return queue;
+            }
+
+            // cached without dynamic initialization, so that the owner check is a single thread-local load, 0 is no queue
+            static inline thread_local constinit std::uint64_t current_id = 0;
+            static inline thread_local constinit biased_queue* current = nullptr;
+        };
+    }
+
+    struct proxy_counter_biased
+    {
+        // biased reference counting, the thread that creates the counter owns it and updates its own count without atomic
+        // operations, while other threads update an atomic shared count. the owner merges both counts once its own count
+        // reaches zero, or when another thread queues the counter because the shared count became negative.
+        //   shared layout: (count << 2) | queued | merged
+
+        static constexpr std::int64_t merged_flag = 1;
+        static constexpr std::int64_t queued_flag = 2;
+        static constexpr std::int64_t count_unit = 4;
+
+        using dispose_type = void (*)(proxy_counter_biased&) noexcept;
+
+        std::uint64_t owner = 0;
+        dispose_type dispose = nullptr;
+        proxy_counter_biased* next = nullptr;
+        std::uint32_t biased = 0;
+        bool merged = false;
+        std::atomic<std::int64_t> shared = 0;
+
+        [[nodiscard]] std::int64_t use_count() const noexcept
+        {
+            return biased + (shared.load(std::memory_order_relaxed) >> 2);
+        }
+
+        // merges counters queued to the calling thread, this is otherwise done lazily on the next counter operation of
+        // the calling thread, or when the calling thread exits
+        static void merge_pending() noexcept
+        {
+            proxies::detail::biased_queue::local().drain();
+        }
+
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE static constexpr bool is_disposable(const std::int64_t word) noexcept
+        {
+            return word == merged_flag;
+        }
+
+        [[nodiscard]] static bool merge(proxy_counter_biased& counter, const bool queued) noexcept
+        {
+            std::int64_t delta = static_cast<std::int64_t>(counter.biased) * count_unit;
+
+            if (not counter.merged)
+            {
+                delta += merged_flag;
+            }
+
+            if (queued)
+            {
+                delta -= queued_flag;
+            }
+
+            counter.biased = 0;
+            counter.merged = true;
+
+            return is_disposable(counter.shared.fetch_add(delta, std::memory_order_acq_rel) + delta);
+        }
+    };
+
+    namespace proxies::detail
+    {
+        inline biased_queue::biased_queue() noexcept
+        {
+            std::lock_guard lock {registry_mutex()};
+            id = ++last_id();
+            registry().emplace(id, this);
+
+            current_id = id;
+            current = this;
+        }
+
+        inline biased_queue::~biased_queue() noexcept
+        {
+            {
+                std::lock_guard lock {registry_mutex()};
+                registry().erase(id);
+            }
+
+            drain();
+
+            current_id = 0;
+            current = nullptr;
+        }
+
+        inline void biased_queue::push(proxy_counter_biased& counter) noexcept
+        {
+            proxy_counter_biased* next = head.load(std::memory_order_relaxed);
+
+            do
+            {
+                counter.next = next;
+            } while (not head.compare_exchange_weak(next, std::addressof(counter), std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        inline void biased_queue::drain() noexcept
+        {
+            proxy_counter_biased* counter = head.exchange(nullptr, std::memory_order_acquire);
+
+            while (counter != nullptr)
+            {
+                proxy_counter_biased* next = counter->next;
+
+                if (proxy_counter_biased::merge(*counter, true))
+                {
+                    counter->dispose(*counter);
+                }
+
+                counter = next;
+            }
+        }
+
+        template <>
+        struct counter_traits<proxy_counter_biased>
+        {
+            using dispose_type = proxy_counter_biased::dispose_type;
+
+            SPORE_PROXY_FORCE_INLINE static void init(proxy_counter_biased& counter, const dispose_type dispose) noexcept
+            {
+                counter.owner = biased_queue::local().id;
+                counter.dispose = dispose;
+                counter.biased = 1;
+            }
+
+            SPORE_PROXY_FORCE_INLINE static void increment(proxy_counter_biased& counter) noexcept
+            {
+                if (is_owner(counter)) [[likely]]
+                {
+                    ++counter.biased;
+                }
+                else
+                {
+                    counter.shared.fetch_add(proxy_counter_biased::count_unit, std::memory_order_relaxed);
+                }
+            }
+
+            [[nodiscard]] SPORE_PROXY_FORCE_INLINE static bool decrement(proxy_counter_biased& counter) noexcept
+            {
+                if (is_owner(counter)) [[likely]]
+                {
+                    return --counter.biased == 0 and proxy_counter_biased::merge(counter, false);
+                }
+
+                return decrement_shared(counter);
+            }
+
+          private:
+            [[nodiscard]] SPORE_PROXY_FORCE_INLINE static bool is_owner(proxy_counter_biased& counter) noexcept
+            {
+                // only the owner can read its merged flag, and it drains its queue first since it may merge this counter
+                if (counter.owner == biased_queue::current_id)
+                {
+                    biased_queue::current->drain_if_pending();
+                    return not counter.merged;
+                }
+
+                return false;
+            }
+
+            [[nodiscard]] static bool decrement_shared(proxy_counter_biased& counter) noexcept
+            {
+                constexpr std::int64_t count_unit = proxy_counter_biased::count_unit;
+                constexpr std::int64_t merged_flag = proxy_counter_biased::merged_flag;
+                constexpr std::int64_t queued_flag = proxy_counter_biased::queued_flag;
+
+                std::int64_t word = counter.shared.fetch_sub(count_unit, std::memory_order_acq_rel) - count_unit;
+
+                if ((word & merged_flag) != 0)
+                {
+                    return proxy_counter_biased::is_disposable(word);
+                }
+
+                // the owner still holds biased references, a negative count means that some of them were released by
+                // this thread, so the owner must merge both counts to find out whether the value is still alive
+                while (not (word & (merged_flag | queued_flag)) and word < 0)
+                {
+                    if (counter.shared.compare_exchange_weak(word, word | queued_flag, std::memory_order_acq_rel, std::memory_order_relaxed))
+                    {
+                        enqueue(counter);
+                        break;
+                    }
+                }
+
+                return false;
+            }
+
+            static void enqueue(proxy_counter_biased& counter) noexcept
+            {
+                bool disposable = false;
+
+                {
+                    std::lock_guard lock {biased_queue::registry_mutex()};
+
+                    auto& queues = biased_queue::registry();
+
+                    if (const auto it = queues.find(counter.owner); it != queues.end())
+                    {
+                        it->second->push(counter);
+                    }
+                    else
+                    {
+                        // the owner has exited, its biased count cannot change anymore and is merged on its behalf
+                        disposable = proxy_counter_biased::merge(counter, true);
+                    }
+                }
+
+                if (disposable)
+                {
+                    counter.dispose(counter);
+                }
+            }
+        };
+    }
+}
\ No newline at end of file
@@ -1,14 +1,26 @@
 #pragma once
 
 #include "spore/proxy/proxy_base.hpp"
+#include "spore/proxy/proxy_concepts.hpp"
 #include "spore/proxy/proxy_facade.hpp"
+#include "spore/proxy/proxy_instrument.hpp"
 #include "spore/proxy/proxy_macros.hpp"
+#include "spore/proxy/proxy_registry.hpp"
+#include "spore/proxy/proxy_storage.hpp"
+#include "spore/proxy/proxy_type_info.hpp"
 #include "spore/proxy/proxy_type_set.hpp"
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstddef>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #ifndef SPORE_PROXY_DISPATCH_DEFAULT
@@ -19,6 +31,48 @@ namespace spore
 {
     namespace proxies::detail
     {
+        template <typename tag_t>
+        struct index_impl
+        {
+            static inline std::atomic<std::uint32_t> seed;
+
+            template <typename value_t>
+            static inline std::uint32_t value = index_impl::seed++;
+        };
+
+        template <typename facade_t>
+        struct type_index_tag;
+
+        template <typename facade_t, typename value_t>
+        std::uint32_t type_index()
+        {
+            return index_impl<type_index_tag<facade_t>>::template value<value_t>;
+        }
+
+        // the self of a dispatch is forwarded with the qualifiers of the method, the value of a hooked storage is found
+        // through its storage, which runs its hook first
+        template <typename self_t, typename value_t, typename void_t>
+        SPORE_PROXY_FORCE_INLINE constexpr decltype(auto) dispatch_self(void_t* ptr) SPORE_PROXY_THROW_SPEC
+        {
+            if constexpr (not std::is_same_v<value_t, unhooked_value_t<value_t>>)
+            {
+                using storage_t = std::conditional_t<std::is_const_v<void_t>, const typename value_t::storage_type, typename value_t::storage_type>;
+                return dispatch_self<self_t, typename value_t::value_type>(static_cast<storage_t*>(ptr)->dispatch_ptr());
+            }
+            else if constexpr (std::is_const_v<std::remove_reference_t<self_t>>)
+            {
+                return *static_cast<const value_t*>(ptr);
+            }
+            else if constexpr (std::is_lvalue_reference_v<self_t>)
+            {
+                return *static_cast<value_t*>(ptr);
+            }
+            else
+            {
+                return std::move(*static_cast<value_t*>(ptr));
+            }
+        }
+
         template <typename facade_t, typename func_t, typename self_t, typename signature_t>
         struct dispatch_mapping;
 
@@ -26,54 +80,257 @@ namespace spore
         struct dispatch_mapping<facade_t, func_t, self_t, return_t(args_t...)>
         {
             using facade_type = facade_t;
+            using func_type = func_t;
             using void_type = std::conditional_t<std::is_const_v<std::remove_reference_t<self_t>>, const void, void>;
             using dispatch_type = return_t (*)(void_type*, args_t&&...);
 
+            // a function with a static resolve receives the type the value was registered with instead of the value,
+            // e.g. to find the dispatch function of a pair of values
             template <typename value_t>
             SPORE_PROXY_FORCE_INLINE static constexpr return_t dispatch(void_type* ptr, args_t&&... args) SPORE_PROXY_THROW_SPEC
             {
-                if constexpr (std::is_const_v<std::remove_reference_t<self_t>>)
+                if constexpr (requires { func_t::template resolve<value_t>(std::declval<args_t>()...); })
                 {
-                    return func_t {}(*static_cast<const value_t*>(ptr), std::forward<args_t>(args)...);
-                }
-                else if constexpr (std::is_lvalue_reference_v<self_t>)
-                {
-                    return func_t {}(*static_cast<value_t*>(ptr), std::forward<args_t>(args)...);
+                    return func_t::template resolve<value_t>(std::forward<args_t>(args)...);
                 }
                 else
                 {
-                    return func_t {}(std::move(*static_cast<value_t*>(ptr)), std::forward<args_t>(args)...);
+                    return func_t {}(dispatch_self<self_t, value_t>(ptr), std::forward<args_t>(args)...);
                 }
             }
         };
 
-        template <typename tag_t>
-        struct index_impl
+        template <typename first_facade_t, typename second_facade_t, typename func_t, typename first_self_t, typename second_self_t, typename signature_t>
+        struct dispatch_multi_mapping;
+
+        template <typename first_facade_t, typename second_facade_t, typename func_t, typename first_self_t, typename second_self_t, typename return_t, typename... args_t>
+        struct dispatch_multi_mapping<first_facade_t, second_facade_t, func_t, first_self_t, second_self_t, return_t(args_t...)>
         {
-            static inline std::atomic<std::uint32_t> seed;
+            using first_void_type = std::conditional_t<std::is_const_v<std::remove_reference_t<first_self_t>>, const void, void>;
+            using second_void_type = std::conditional_t<std::is_const_v<std::remove_reference_t<second_self_t>>, const void, void>;
+            using dispatch_type = return_t (*)(first_void_type*, second_void_type*, args_t&&...);
 
-            template <typename value_t>
-            static inline std::uint32_t value = index_impl::seed++;
+            template <typename first_value_t, typename second_value_t>
+            SPORE_PROXY_FORCE_INLINE static constexpr return_t dispatch(first_void_type* first_ptr, second_void_type* second_ptr, args_t&&... args) SPORE_PROXY_THROW_SPEC
+            {
+                return func_t {}(
+                    dispatch_self<first_self_t, first_value_t>(first_ptr),
+                    dispatch_self<second_self_t, second_value_t>(second_ptr),
+                    std::forward<args_t>(args)...);
+            }
+        };
+    }
+
+    template <typename mapping_t>
+    using proxy_dispatch_func = typename mapping_t::dispatch_type;
+
+    template <typename mapping_t>
+    struct proxy_binding;
+
+    // a dispatch resolved once, it holds the value and the function of its mapping and is valid as long as a reference
+    // to the value would be
+    template <typename facade_t, typename func_t, typename self_t, typename return_t, typename... args_t>
+    struct proxy_binding<proxies::detail::dispatch_mapping<facade_t, func_t, self_t, return_t(args_t...)>>
+    {
+        using mapping_type = proxies::detail::dispatch_mapping<facade_t, func_t, self_t, return_t(args_t...)>;
+        using void_type = typename mapping_type::void_type;
+
+        constexpr proxy_binding(void_type* ptr, const proxy_dispatch_func<mapping_type> dispatch) noexcept
+            : _ptr(ptr),
+              _dispatch(dispatch)
+        {
+        }
+
+        SPORE_PROXY_FORCE_INLINE constexpr return_t operator()(args_t... args) const& SPORE_PROXY_THROW_SPEC
+            requires(std::is_lvalue_reference_v<self_t>)
+        {
+            return _dispatch(_ptr, std::forward<args_t>(args)...);
+        }
+
+        // bound to an r-value, the value is moved from so the binding is too
+        SPORE_PROXY_FORCE_INLINE constexpr return_t operator()(args_t... args) && SPORE_PROXY_THROW_SPEC
+            requires(not std::is_lvalue_reference_v<self_t>)
+        {
+            return _dispatch(_ptr, std::forward<args_t>(args)...);
+        }
+
+      private:
+        void_type* _ptr;
+        proxy_dispatch_func<mapping_type> _dispatch;
+    };
+
+    // a method whose function is resolved once per proxy and stored in it, the qualifiers of the signature are those
+    // of the method, e.g. std::size_t(std::size_t) const
+    template <typename func_t, typename signature_t>
+    struct proxy_inline_slot
+    {
+        // the function of a method is deduced without its const, e.g. from decltype of a static constexpr lambda
+        using func_type = std::remove_cv_t<func_t>;
+        using signature_type = signature_t;
+    };
+
+    // the inline slots of a facade, a derived facade lists the inline slots of its base facades first
+    template <typename... slots_t>
+    struct proxy_inline_slots
+    {
+        template <typename... other_slots_t>
+        using append = proxy_inline_slots<slots_t..., other_slots_t...>;
+    };
+
+    // passed to the function of proxies::dispatch_emplace, the implementation constructs its result proxy with it, which
+    // is then returned as a prvalue right into the caller's return slot
+    template <typename proxy_t>
+    struct proxy_return_slot
+    {
+        using proxy_type = proxy_t;
+
+        template <typename value_t, typename... args_t>
+        [[nodiscard]] constexpr proxy_t emplace(args_t&&... args) const SPORE_PROXY_THROW_SPEC
+        {
+            return proxy_t {std::in_place_type<value_t>, std::forward<args_t>(args)...};
+        }
+    };
+
+    namespace proxies::detail
+    {
+        template <typename self_t, typename signature_t>
+        struct inline_slot_call;
+
+        template <typename self_t, typename return_t, typename... args_t>
+        struct inline_slot_call<self_t, return_t(args_t...)>
+        {
+            using self_type = self_t;
+            using return_type = return_t;
+            using signature_type = return_t(args_t...);
+
+            // arguments are converted to the types of the slot, a slot taking values copies them once
+            template <typename dispatch_t, typename void_t, typename... call_args_t>
+            SPORE_PROXY_FORCE_INLINE static constexpr return_t invoke(const dispatch_t dispatch, void_t* ptr, call_args_t&&... args) SPORE_PROXY_THROW_SPEC
+            {
+                return dispatch(ptr, static_cast<args_t>(std::forward<call_args_t>(args))...);
+            }
+        };
+
+        template <typename facade_t, typename signature_t>
+        struct inline_slot_traits;
+
+        template <typename facade_t, typename return_t, typename... args_t>
+        struct inline_slot_traits<facade_t, return_t(args_t...)> : inline_slot_call<facade_t&, return_t(args_t...)>
+        {
+        };
+
+        template <typename facade_t, typename return_t, typename... args_t>
+        struct inline_slot_traits<facade_t, return_t(args_t...) const> : inline_slot_call<const facade_t&, return_t(args_t...)>
+        {
+        };
+
+        template <typename facade_t, typename return_t, typename... args_t>
+        struct inline_slot_traits<facade_t, return_t(args_t...)&> : inline_slot_call<facade_t&, return_t(args_t...)>
+        {
+        };
+
+        template <typename facade_t, typename return_t, typename... args_t>
+        struct inline_slot_traits<facade_t, return_t(args_t...) const&> : inline_slot_call<const facade_t&, return_t(args_t...)>
+        {
+        };
+
+        template <typename facade_t, typename return_t, typename... args_t>
+        struct inline_slot_traits<facade_t, return_t(args_t...) &&> : inline_slot_call<facade_t, return_t(args_t...)>
+        {
+        };
+
+        template <typename facade_t, typename slot_t>
+        struct inline_slot_mapping
+        {
+            using traits_type = inline_slot_traits<facade_t, typename slot_t::signature_type>;
+            using type = dispatch_mapping<facade_t, typename slot_t::func_type, typename traits_type::self_type, typename traits_type::signature_type>;
         };
 
         template <typename facade_t>
-        struct type_index_tag;
+        struct facade_inline_slots
+        {
+            using type = proxy_inline_slots<>;
+        };
 
-        template <typename facade_t, typename value_t>
-        std::uint32_t type_index()
+        template <typename facade_t>
+            requires requires { typename facade_t::inline_slots; }
+        struct facade_inline_slots<facade_t>
         {
-            return index_impl<type_index_tag<facade_t>>::template value<value_t>;
+            using type = typename facade_t::inline_slots;
+        };
+
+        template <typename facade_t>
+        inline constexpr bool has_inline_slots = not std::is_same_v<typename facade_inline_slots<facade_t>::type, proxy_inline_slots<>>;
+
+        template <typename slots_t, typename base_slots_t>
+        inline constexpr bool inline_slots_start_with = false;
+
+        template <typename... slots_t, typename... base_slots_t>
+        inline constexpr bool inline_slots_start_with<proxy_inline_slots<slots_t...>, proxy_inline_slots<base_slots_t...>> = [] {
+            if constexpr (sizeof...(base_slots_t) > sizeof...(slots_t))
+            {
+                return false;
+            }
+            else
+            {
+                return []<std::size_t... indices_v>(std::index_sequence<indices_v...>) {
+                    return (std::is_same_v<std::tuple_element_t<indices_v, std::tuple<slots_t...>>, base_slots_t> and ...);
+                }(std::index_sequence_for<base_slots_t...> {});
+            }
+        }();
+
+        template <typename facade_t>
+        struct facade_bases
+        {
+            template <typename... bases_t>
+            static auto of(const proxy_facade<facade_t, bases_t...>*) -> std::tuple<bases_t...>;
+
+            using type = decltype(of(static_cast<const facade_t*>(nullptr)));
+        };
+
+        // the inline slots of a base facade are read at the same offsets from a proxy of a derived facade, so a derived
+        // facade lists them first, and the slots of two base facades can't both come first
+        template <typename facade_t>
+        consteval bool inline_slots_follow_bases()
+        {
+            return []<typename... bases_t>(std::type_identity<std::tuple<bases_t...>>) {
+                constexpr std::size_t count = (std::size_t {0} + ... + static_cast<std::size_t>(has_inline_slots<bases_t>));
+
+                if constexpr (count > 1)
+                {
+                    return false;
+                }
+                else
+                {
+                    return (... and (not has_inline_slots<bases_t> or inline_slots_start_with<typename facade_inline_slots<facade_t>::type, typename facade_inline_slots<bases_t>::type>)) and
+                           (... and inline_slots_follow_bases<bases_t>());
+                }
+            }(std::type_identity<typename facade_bases<facade_t>::type> {});
         }
     }
 
-    template <typename mapping_t>
-    using proxy_dispatch_func = typename mapping_t::dispatch_type;
+    namespace proxies::detail
+    {
+        // dispatchers can observe the values registered to a mapping, and take over each dispatch, looking up the table
+        // themselves
+        template <typename dispatch_t, typename mapping_t, typename value_t>
+        concept dispatch_add_value_override = requires(std::uint32_t type_index) {
+            dispatch_t::template add_value<mapping_t, value_t>(type_index);
+        };
+
+        template <typename dispatch_t, typename mapping_t, typename void_t, typename... args_t>
+        concept dispatch_invoke_override = requires(std::uint32_t type_index, void_t* ptr, args_t&&... args) {
+            dispatch_t::template invoke<mapping_t>(type_index, ptr, std::forward<args_t>(args)...);
+        };
+    }
 
     template <std::size_t size_v = 16, std::float_t grow_v = 1.5f>
     struct [[maybe_unused]] proxy_dispatch_dynamic
     {
+        // constant-initialized and sized on the first registration, gcc skips the dynamic initialization of a
+        // thread-local variable template that is first used from a mapping registered while another one is instantiated
         template <typename mapping_t>
-        static inline thread_local std::vector<proxy_dispatch_func<mapping_t>> dispatches {size_v};
+        static inline thread_local std::vector<proxy_dispatch_func<mapping_t>> dispatches;
 
         template <typename tag_t, typename func_t>
         SPORE_PROXY_FORCE_INLINE static void call_once(const func_t&)
@@ -104,14 +361,27 @@ namespace spore
         {
             std::vector<proxy_dispatch_func<mapping_t>>& mapping_dispatches = dispatches<mapping_t>;
 
+            // constructed after the table of this thread, so that it is unlisted before the table is destroyed
+            [[maybe_unused]] static thread_local const proxies::detail::registry_table_guard guard {
+                proxies::detail::registry_table::of<proxy_dispatch_dynamic, mapping_t>(std::addressof(mapping_dispatches), std::this_thread::get_id(), &describe<mapping_t>)};
+
+            const auto lock = guard.lock();
+
             if (type_index >= mapping_dispatches.size()) [[unlikely]]
             {
-                const std::size_t new_size = std::max<std::size_t>(type_index + 1, mapping_dispatches.size() * grow_v);
+                const std::size_t new_size = std::max<std::size_t>({type_index + 1, size_v, static_cast<std::size_t>(mapping_dispatches.size() * grow_v)});
                 mapping_dispatches.resize(new_size);
             }
 
             mapping_dispatches[type_index] = dispatch;
         }
+
+        template <typename mapping_t>
+        static void describe(const void* entries, proxy_registry_table& table) noexcept
+        {
+            const auto& mapping_dispatches = *static_cast<const std::vector<proxy_dispatch_func<mapping_t>>*>(entries);
+            proxies::detail::registry_table::describe_entries(mapping_dispatches.data(), mapping_dispatches.size(), mapping_dispatches.capacity(), table);
+        }
     };
 
     template <std::size_t size_v = 64>
@@ -142,12 +412,188 @@ namespace spore
         SPORE_PROXY_FORCE_INLINE static void set_dispatch(const std::uint32_t type_index, const proxy_dispatch_func<mapping_t> dispatch) noexcept
         {
             SPORE_PROXY_ASSERT(type_index < size_v);
+
+            [[maybe_unused]] static const proxies::detail::registry_table_guard guard {
+                proxies::detail::registry_table::of<proxy_dispatch_static, mapping_t>(dispatches<mapping_t>, std::thread::id {}, &describe<mapping_t>)};
+
+            const auto lock = guard.lock();
             dispatches<mapping_t>[type_index] = dispatch;
         }
+
+        template <typename mapping_t>
+        static void describe(const void* entries, proxy_registry_table& table) noexcept
+        {
+            proxies::detail::registry_table::describe_entries(static_cast<const proxy_dispatch_func<mapping_t>*>(entries), size_v, size_v, table);
+        }
     };
 
     using proxy_dispatch_default = SPORE_PROXY_DISPATCH_DEFAULT;
 
+    // wraps another dispatcher to count dispatches per mapping and value type in per-thread counters, one dispatch out
+    // of sample_v is also timed, see proxies::dispatch_snapshot. dispatches are also recorded during a capture, see
+    // proxies::capture_begin
+    template <typename dispatch_t = proxy_dispatch_default, std::uint64_t sample_v = 0>
+    struct [[maybe_unused]] proxy_dispatch_instrumented
+    {
+        template <typename tag_t, typename func_t>
+        SPORE_PROXY_FORCE_INLINE static void call_once(const func_t& func)
+        {
+            dispatch_t::template call_once<tag_t>(func);
+        }
+
+        template <typename mapping_t>
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE static proxy_dispatch_func<mapping_t> get_dispatch(const std::uint32_t type_index) noexcept
+        {
+            return dispatch_t::template get_dispatch<mapping_t>(type_index);
+        }
+
+        template <typename mapping_t>
+        SPORE_PROXY_FORCE_INLINE static void set_dispatch(const std::uint32_t type_index, const proxy_dispatch_func<mapping_t> dispatch) noexcept
+        {
+            dispatch_t::template set_dispatch<mapping_t>(type_index, dispatch);
+        }
+
+        template <typename mapping_t, typename value_t>
+        static void add_value(const std::uint32_t type_index)
+        {
+            using namespace proxies::detail;
+
+            instrument_type_names::add(instrument_mapping_of<mapping_t>(), type_index, type_name<unhooked_value_t<value_t>>());
+        }
+
+        template <typename mapping_t, typename void_t, typename... args_t>
+        SPORE_PROXY_FORCE_INLINE static decltype(auto) invoke(const std::uint32_t type_index, void_t* ptr, args_t&&... args)
+        {
+            using namespace proxies::detail;
+
+            const proxy_dispatch_func<mapping_t> dispatch = dispatch_t::template get_dispatch<mapping_t>(type_index);
+
+            SPORE_PROXY_ASSERT(dispatch != nullptr);
+
+            static thread_local instrument_dispatch_table& table = instrument_thread::local().find_dispatch_table(instrument_mapping_of<mapping_t>());
+
+            instrument_dispatch_counters& counters = instrument_thread::local().find_dispatch(table, type_index);
+
+            const std::uint64_t calls = counters.calls.load(std::memory_order_relaxed) + 1;
+            counters.calls.store(calls, std::memory_order_relaxed);
+
+            if (instrument_capture::active.load(std::memory_order_relaxed)) [[unlikely]]
+            {
+                instrument_thread::local().capture(table.mapping_id, type_index);
+            }
+
+            if constexpr (sample_v != 0)
+            {
+                if (calls % sample_v == 0) [[unlikely]]
+                {
+                    struct sample_guard
+                    {
+                        instrument_dispatch_counters& counters;
+                        std::chrono::steady_clock::time_point then = std::chrono::steady_clock::now();
+
+                        ~sample_guard() noexcept
+                        {
+                            const std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - then;
+                            counters.samples.store(counters.samples.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                            counters.sampled_nanoseconds.store(counters.sampled_nanoseconds.load(std::memory_order_relaxed) + duration.count(), std::memory_order_relaxed);
+                        }
+                    };
+
+                    const sample_guard guard {counters};
+                    return dispatch(ptr, std::forward<args_t>(args)...);
+                }
+            }
+
+            return dispatch(ptr, std::forward<args_t>(args)...);
+        }
+    };
+
+    // the values dispatched to most often, in order
+    template <typename... values_t>
+    struct proxy_dispatch_hot
+    {
+    };
+
+    // the hot values of a facade, specialized by the header generated from a profiling run, see
+    // proxies::dispatch_profile_header
+    template <typename facade_t>
+    struct proxy_dispatch_profile : proxy_dispatch_hot<>
+    {
+    };
+
+    // wraps another dispatcher to compare the type index against the hot values of the facade's profile and call their
+    // dispatch directly, other values go through the wrapped dispatcher. when SPORE_PROXY_INSTRUMENT is defined, it counts
+    // dispatches like proxy_dispatch_instrumented instead, so that a profiling run can generate the profile.
+    template <typename dispatch_t = proxy_dispatch_default>
+    struct [[maybe_unused]] proxy_dispatch_speculative
+#ifdef SPORE_PROXY_INSTRUMENT
+        : proxy_dispatch_instrumented<dispatch_t>
+    {
+    };
+#else
+    {
+        template <typename tag_t, typename func_t>
+        SPORE_PROXY_FORCE_INLINE static void call_once(const func_t& func)
+        {
+            dispatch_t::template call_once<tag_t>(func);
+        }
+
+        template <typename mapping_t>
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE static proxy_dispatch_func<mapping_t> get_dispatch(const std::uint32_t type_index) noexcept
+        {
+            return dispatch_t::template get_dispatch<mapping_t>(type_index);
+        }
+
+        template <typename mapping_t>
+        SPORE_PROXY_FORCE_INLINE static void set_dispatch(const std::uint32_t type_index, const proxy_dispatch_func<mapping_t> dispatch) noexcept
+        {
+            dispatch_t::template set_dispatch<mapping_t>(type_index, dispatch);
+        }
+
+        template <typename mapping_t, typename value_t>
+            requires proxies::detail::dispatch_add_value_override<dispatch_t, mapping_t, value_t>
+        static void add_value(const std::uint32_t type_index)
+        {
+            dispatch_t::template add_value<mapping_t, value_t>(type_index);
+        }
+
+        template <typename mapping_t, typename void_t, typename... args_t>
+        SPORE_PROXY_FORCE_INLINE static decltype(auto) invoke(const std::uint32_t type_index, void_t* ptr, args_t&&... args)
+        {
+            return invoke_hot<mapping_t>(proxy_dispatch_profile<typename mapping_t::facade_type> {}, type_index, ptr, std::forward<args_t>(args)...);
+        }
+
+      private:
+        template <typename mapping_t, typename value_t, typename... values_t, typename void_t, typename... args_t>
+        SPORE_PROXY_FORCE_INLINE static decltype(auto) invoke_hot(proxy_dispatch_hot<value_t, values_t...>, const std::uint32_t type_index, void_t* ptr, args_t&&... args)
+        {
+            if (type_index == proxies::detail::type_index<typename mapping_t::facade_type, value_t>())
+            {
+                return mapping_t::template dispatch<value_t>(ptr, std::forward<args_t>(args)...);
+            }
+
+            return invoke_hot<mapping_t>(proxy_dispatch_hot<values_t...> {}, type_index, ptr, std::forward<args_t>(args)...);
+        }
+
+        template <typename mapping_t, typename void_t, typename... args_t>
+        SPORE_PROXY_FORCE_INLINE static decltype(auto) invoke_hot(proxy_dispatch_hot<>, const std::uint32_t type_index, void_t* ptr, args_t&&... args)
+        {
+            if constexpr (proxies::detail::dispatch_invoke_override<dispatch_t, mapping_t, void_t, args_t...>)
+            {
+                return dispatch_t::template invoke<mapping_t>(type_index, ptr, std::forward<args_t>(args)...);
+            }
+            else
+            {
+                const proxy_dispatch_func<mapping_t> dispatch = dispatch_t::template get_dispatch<mapping_t>(type_index);
+
+                SPORE_PROXY_ASSERT(dispatch != nullptr);
+
+                return dispatch(ptr, std::forward<args_t>(args)...);
+            }
+        }
+    };
+#endif
+
     namespace proxies
     {
         namespace detail
@@ -212,6 +658,19 @@ namespace spore
                 }
             };
 
+            template <typename func_t, typename proxy_t>
+            struct dispatch_emplace
+            {
+                template <typename self_t, typename... args_t>
+                constexpr proxy_t operator()(self_t&& self, args_t&&... args) const SPORE_PROXY_THROW_SPEC
+                {
+                    // any other result would be converted, moving its storage
+                    static_assert(std::is_same_v<std::invoke_result_t<func_t, self_t&&, proxy_return_slot<proxy_t>, args_t&&...>, proxy_t>);
+
+                    return func_t {}(std::forward<self_t>(self), proxy_return_slot<proxy_t> {}, std::forward<args_t>(args)...);
+                }
+            };
+
             template <typename facade_t>
             concept facade_dispatch_type_override = requires {
                 { std::in_place_type<typename facade_t::dispatch_type> };
@@ -258,6 +717,11 @@ namespace spore
                 dispatch_t::template call_once<tag_t>([] {
                     const std::uint32_t type_index = proxies::detail::type_index<facade_t, value_t>();
                     dispatch_t::template set_dispatch<mapping_t>(type_index, &mapping_t::template dispatch<value_t>);
+
+                    if constexpr (dispatch_add_value_override<dispatch_t, mapping_t, value_t>)
+                    {
+                        dispatch_t::template add_value<mapping_t, value_t>(type_index);
+                    }
                 });
             }
 
@@ -269,12 +733,14 @@ namespace spore
                 dispatch_t::template call_once<tag_t>([] {
                     proxies::detail::add_facade<facade_t>();
                     proxies::detail::type_sets::emplace<proxies::detail::value_tag<facade_t>, value_t>();
+                    proxies::detail::registry_add_value<dispatch_t, facade_t, proxies::detail::unhooked_value_t<value_t>>();
 
                     proxies::detail::type_sets::for_each<proxies::detail::mapping_tag<facade_t>>([]<typename mapping_t> {
                         proxies::detail::add_value_mapping_once<value_t, mapping_t>();
                     });
 
                     proxies::detail::type_sets::for_each<proxies::detail::base_tag<facade_t>>([]<typename base_facade_t> {
+                        proxies::detail::registry_add_base<dispatch_t, facade_t, base_facade_t>();
                         proxies::detail::add_facade_value_once<base_facade_t, value_t>();
                     });
                 });
@@ -288,12 +754,14 @@ namespace spore
                 dispatch_t::template call_once<tag_t>([] {
                     proxies::detail::add_facade<facade_t>();
                     proxies::detail::type_sets::emplace<proxies::detail::mapping_tag<facade_t>, mapping_t>();
+                    proxies::detail::registry_add_mapping<dispatch_t, facade_t, mapping_t>();
 
                     proxies::detail::type_sets::for_each<proxies::detail::value_tag<facade_t>>([]<typename value_t> {
                         proxies::detail::add_value_mapping_once<value_t, mapping_t>();
                     });
 
                     proxies::detail::type_sets::for_each<proxies::detail::base_tag<facade_t>>([]<typename base_t> {
+                        proxies::detail::registry_add_base<dispatch_t, facade_t, base_t>();
                         proxies::detail::type_sets::for_each<proxies::detail::value_tag<base_t>>([]<typename value_t> {
                             proxies::detail::add_value_mapping_once<value_t, mapping_t>();
                         });
@@ -301,6 +769,149 @@ namespace spore
                 });
             }
 
+            // the index of the value of another proxy once converted to a proxy of facade_t and storage_t, for storages
+            // that register their values differently, e.g. a value proxy converted to a copy-on-write proxy
+            template <typename facade_t, typename storage_t>
+            struct dispatch_converted_type_index
+            {
+                template <typename value_t>
+                static std::uint32_t resolve() noexcept
+                {
+                    using stored_value_t = proxies::detail::stored_value_t<storage_t, proxies::detail::unhooked_value_t<value_t>>;
+
+                    proxies::detail::add_facade_value_once<facade_t, stored_value_t>();
+                    return proxies::detail::type_index<facade_t, stored_value_t>();
+                }
+            };
+
+            // the functions of a facade's inline slots, stored right after the proxy base. they are type erased so that
+            // the inline slots of a base facade are read the same from a proxy of a derived facade
+            template <typename facade_t, typename slots_t = typename facade_inline_slots<facade_t>::type>
+            struct inline_slot_table;
+
+            template <typename facade_t>
+            struct inline_slot_table<facade_t, proxy_inline_slots<>>
+            {
+                static_assert(inline_slots_follow_bases<facade_t>(), "a facade must list the inline slots of its base facade first, and only one base facade may have inline slots");
+
+                static constexpr std::size_t size = 0;
+
+                template <typename func_t>
+                static constexpr bool contains = false;
+
+                template <typename value_t>
+                SPORE_PROXY_FORCE_INLINE void resolve() noexcept
+                {
+                }
+
+                SPORE_PROXY_FORCE_INLINE void resolve(std::uint32_t) noexcept
+                {
+                }
+            };
+
+            template <typename facade_t, typename... slots_t>
+            struct inline_slot_table<facade_t, proxy_inline_slots<slots_t...>>
+            {
+                static_assert(inline_slots_follow_bases<facade_t>(), "a facade must list the inline slots of its base facade first, and only one base facade may have inline slots");
+
+                using generic_type = void (*)();
+
+                static constexpr std::size_t size = sizeof...(slots_t);
+
+                static_assert(size <= std::numeric_limits<std::uint8_t>::max());
+
+                template <typename func_t>
+                static constexpr bool contains = (std::is_same_v<func_t, typename slots_t::func_type> or ...);
+
+                template <typename func_t>
+                static constexpr std::size_t index_of = [] {
+                    std::size_t index = 0;
+                    ((std::is_same_v<func_t, typename slots_t::func_type> ? false : (++index, true)) and ...);
+                    return index;
+                }();
+
+                template <std::size_t index_v>
+                using slot_type = std::tuple_element_t<index_v, std::tuple<slots_t...>>;
+
+                template <std::size_t index_v>
+                using mapping_type = typename inline_slot_mapping<facade_t, slot_type<index_v>>::type;
+
+                template <std::size_t index_v>
+                [[nodiscard]] SPORE_PROXY_FORCE_INLINE static proxy_dispatch_func<mapping_type<index_v>> get(const proxy_base& proxy) noexcept
+                {
+                    SPORE_PROXY_ASSERT(index_v < proxy.slot_count());
+
+                    const auto* slots = reinterpret_cast<const generic_type*>(reinterpret_cast<const std::byte*>(std::addressof(proxy)) + sizeof(proxy_base));
+                    return reinterpret_cast<proxy_dispatch_func<mapping_type<index_v>>>(slots[index_v]);
+                }
+
+                template <typename value_t>
+                SPORE_PROXY_FORCE_INLINE void resolve() noexcept
+                {
+                    [&]<std::size_t... indices_v>(std::index_sequence<indices_v...>) {
+                        ((_slots[indices_v] = reinterpret_cast<generic_type>(&mapping_type<indices_v>::template dispatch<value_t>)), ...);
+                    }(std::index_sequence_for<slots_t...> {});
+                }
+
+                // from a proxy of another facade, the value type is only known by its index
+                void resolve(const std::uint32_t type_index) noexcept
+                {
+                    using dispatch_t = typename select_dispatch_type<facade_t>::type;
+
+                    [&]<std::size_t... indices_v>(std::index_sequence<indices_v...>) {
+                        (proxies::detail::add_facade_mapping_once<facade_t, mapping_type<indices_v>>(), ...);
+
+                        if (type_index == proxy_base::invalid_type_index)
+                        {
+                            _slots.fill(nullptr);
+                        }
+                        else
+                        {
+                            ((_slots[indices_v] = reinterpret_cast<generic_type>(dispatch_t::template get_dispatch<mapping_type<indices_v>>(type_index))), ...);
+                        }
+                    }(std::index_sequence_for<slots_t...> {});
+                }
+
+                std::array<generic_type, size> _slots {};
+            };
+
+            // the value a binding holds and the index of its dispatch, the hook of a hooked storage runs once when binding
+            // and the binding holds its value instead
+            template <typename facade_t, typename void_t>
+            struct dispatch_bind_resolve
+            {
+                template <typename value_t>
+                static std::uint32_t resolve(void_t*& ptr) SPORE_PROXY_THROW_SPEC
+                {
+                    if constexpr (std::is_same_v<value_t, unhooked_value_t<value_t>>)
+                    {
+                        return proxies::detail::type_index<facade_t, value_t>();
+                    }
+                    else
+                    {
+                        using storage_t = std::conditional_t<std::is_const_v<void_t>, const typename value_t::storage_type, typename value_t::storage_type>;
+                        using unhooked_t = typename value_t::value_type;
+
+                        ptr = static_cast<storage_t*>(ptr)->dispatch_ptr();
+
+                        proxies::detail::add_facade_value_once<facade_t, unhooked_t>();
+                        return proxies::detail::type_index<facade_t, unhooked_t>();
+                    }
+                }
+            };
+
+            template <typename self_t>
+            struct self_facade
+            {
+                using type = self_t;
+            };
+
+            template <any_proxy proxy_t>
+            struct self_facade<proxy_t>
+            {
+                using type = typename proxy_t::facade_type;
+            };
+
             template <typename return_t, typename func_t, typename self_t, typename... args_t>
             constexpr return_t dispatch_impl(const func_t&, self_t&& self, args_t&&... args) SPORE_PROXY_THROW_SPEC
             {
@@ -312,14 +923,283 @@ namespace spore
                 static_assert(std::is_empty_v<func_t>);
                 static_assert(std::is_empty_v<facade_t>);
 
+                using slot_table_t = inline_slot_table<facade_t>;
+
+                if constexpr (slot_table_t::template contains<func_t>)
+                {
+                    constexpr std::size_t index = slot_table_t::template index_of<func_t>;
+
+                    using slot_traits_t = typename inline_slot_mapping<facade_t, typename slot_table_t::template slot_type<index>>::traits_type;
+
+                    static_assert(std::is_same_v<typename slot_traits_t::self_type, self_t>, "the qualifiers of the inline slot differ from the method's");
+                    static_assert(std::is_same_v<typename slot_traits_t::return_type, return_t>, "the return type of the inline slot differs from the method's");
+
+                    proxy_base_t& proxy = reinterpret_cast<proxy_base_t&>(self);
+
+                    auto* ptr = proxy.ptr();
+
+                    const auto dispatch = slot_table_t::template get<index>(proxy);
+
+                    SPORE_PROXY_ASSERT(dispatch != nullptr);
+
+                    return slot_traits_t::invoke(dispatch, ptr, std::forward<args_t>(args)...);
+                }
+                else
+                {
+                    proxies::detail::add_facade_mapping_once<facade_t, mapping_t>();
+
+                    proxy_base_t& proxy = reinterpret_cast<proxy_base_t&>(self);
+
+                    auto* ptr = proxy.ptr();
+
+                    if constexpr (dispatch_invoke_override<dispatch_t, mapping_t, std::remove_pointer_t<decltype(ptr)>, args_t...>)
+                    {
+                        return dispatch_t::template invoke<mapping_t>(proxy.type_index(), ptr, std::forward<args_t>(args)...);
+                    }
+                    else
+                    {
+                        const auto dispatch = dispatch_t::template get_dispatch<mapping_t>(proxy.type_index());
+
+                        SPORE_PROXY_ASSERT(dispatch != nullptr);
+
+                        return dispatch(ptr, std::forward<args_t>(args)...);
+                    }
+                }
+            }
+
+            // same mapping as a dispatch from a facade's method, value proxies convert to their facade and other
+            // proxies are bound through their facade, e.g. *proxy
+            template <typename signature_t, typename func_t, typename self_t>
+            constexpr auto bind_impl(self_t&& self) SPORE_PROXY_THROW_SPEC
+            {
+                constexpr bool is_const = std::is_const_v<std::remove_reference_t<self_t>>;
+
+                using facade_t = typename self_facade<std::decay_t<self_t>>::type;
+                using facade_self_t = std::conditional_t<is_const, const facade_t, facade_t>;
+                using mapping_self_t = std::conditional_t<std::is_lvalue_reference_v<self_t>, facade_self_t&, facade_self_t>;
+                using dispatch_t = typename select_dispatch_type<facade_t>::type;
+                using mapping_t = proxies::detail::dispatch_mapping<facade_t, func_t, mapping_self_t, signature_t>;
+                using proxy_base_t = std::conditional_t<is_const, const proxy_base, proxy_base>;
+
+                static_assert(std::is_empty_v<func_t>);
+                static_assert(std::is_empty_v<facade_t>);
+
                 proxies::detail::add_facade_mapping_once<facade_t, mapping_t>();
 
-                proxy_base_t& proxy = reinterpret_cast<proxy_base_t&>(self);
-                const auto dispatch = dispatch_t::template get_dispatch<mapping_t>(proxy.type_index());
+                facade_self_t& facade = self;
+                proxy_base_t& proxy = reinterpret_cast<proxy_base_t&>(facade);
+
+                auto* ptr = proxy.ptr();
+
+                using resolve_t = dispatch_bind_resolve<facade_t, std::remove_pointer_t<decltype(ptr)>>;
+
+                const std::uint32_t type_index = proxies::detail::dispatch_impl<std::uint32_t>(resolve_t {}, facade, ptr);
+                const auto dispatch = dispatch_t::template get_dispatch<mapping_t>(type_index);
 
                 SPORE_PROXY_ASSERT(dispatch != nullptr);
 
-                return dispatch(proxy.ptr(), std::forward<args_t>(args)...);
+                return proxy_binding<mapping_t> {ptr, dispatch};
+            }
+
+            // a row per first value type, flattened in a single array so that a pair of value types is found with one
+            // load, filled lazily per thread and per pair of value types
+            template <typename mapping_t>
+            struct dispatch_multi_table
+            {
+                using dispatch_type = typename mapping_t::dispatch_type;
+
+                struct entries
+                {
+                    std::vector<dispatch_type> dispatches;
+                    std::uint32_t rows = 0;
+                    std::uint32_t stride = 0;
+                };
+
+                [[nodiscard]] SPORE_PROXY_FORCE_INLINE static entries& table() noexcept
+                {
+                    static thread_local entries mapping_entries;
+                    return mapping_entries;
+                }
+
+                [[nodiscard]] SPORE_PROXY_FORCE_INLINE static dispatch_type get(const std::uint32_t first_type_index, const std::uint32_t second_type_index) noexcept
+                {
+                    const entries& table = dispatch_multi_table::table();
+
+                    if (first_type_index < table.rows and second_type_index < table.stride) [[likely]]
+                    {
+                        return table.dispatches[static_cast<std::size_t>(first_type_index) * table.stride + second_type_index];
+                    }
+
+                    return nullptr;
+                }
+
+                // the rows are laid out again when either index grows past the table
+                static void set(const std::uint32_t first_type_index, const std::uint32_t second_type_index, const dispatch_type dispatch)
+                {
+                    entries& table = dispatch_multi_table::table();
+
+                    if (first_type_index >= table.rows or second_type_index >= table.stride)
+                    {
+                        const std::uint32_t rows = std::max(table.rows, first_type_index + 1);
+                        const std::uint32_t stride = std::max(table.stride, second_type_index + 1);
+
+                        std::vector<dispatch_type> dispatches(static_cast<std::size_t>(rows) * stride);
+
+                        for (std::uint32_t row = 0; row < table.rows; ++row)
+                        {
+                            const auto first = table.dispatches.begin() + static_cast<std::ptrdiff_t>(row) * table.stride;
+                            std::copy(first, first + table.stride, dispatches.begin() + static_cast<std::ptrdiff_t>(row) * stride);
+                        }
+
+                        table.dispatches = std::move(dispatches);
+                        table.rows = rows;
+                        table.stride = stride;
+                    }
+
+                    table.dispatches[static_cast<std::size_t>(first_type_index) * table.stride + second_type_index] = dispatch;
+                }
+            };
+
+            // the first value type is found by a dispatch over the first facade, then the second one by a dispatch over
+            // the second facade, which instantiates the function of each pair of known value types. they are resolved as
+            // registered, so that the function runs the hooks of hooked storages
+            template <typename mapping_t, typename first_value_t>
+            struct dispatch_multi_resolve_second
+            {
+                template <typename second_value_t>
+                static constexpr typename mapping_t::dispatch_type resolve() noexcept
+                {
+                    return &mapping_t::template dispatch<first_value_t, second_value_t>;
+                }
+            };
+
+            template <typename mapping_t>
+            struct dispatch_multi_resolve_first
+            {
+                template <typename first_value_t, typename second_facade_t>
+                static constexpr typename mapping_t::dispatch_type resolve(const second_facade_t& second) SPORE_PROXY_THROW_SPEC
+                {
+                    return proxies::detail::dispatch_impl<typename mapping_t::dispatch_type>(dispatch_multi_resolve_second<mapping_t, first_value_t> {}, second);
+                }
+            };
+
+            template <typename return_t, typename func_t, typename first_self_t, typename second_self_t, typename... args_t>
+            constexpr return_t dispatch_multi_impl(const func_t&, first_self_t&& first, second_self_t&& second, args_t&&... args) SPORE_PROXY_THROW_SPEC
+            {
+                constexpr bool is_first_const = std::is_const_v<std::remove_reference_t<first_self_t>>;
+                constexpr bool is_second_const = std::is_const_v<std::remove_reference_t<second_self_t>>;
+
+                using first_facade_t = typename self_facade<std::decay_t<first_self_t>>::type;
+                using second_facade_t = typename self_facade<std::decay_t<second_self_t>>::type;
+                using first_facade_self_t = std::conditional_t<is_first_const, const first_facade_t, first_facade_t>;
+                using second_facade_self_t = std::conditional_t<is_second_const, const second_facade_t, second_facade_t>;
+                using first_mapping_self_t = std::conditional_t<std::is_lvalue_reference_v<first_self_t>, first_facade_self_t&, first_facade_self_t>;
+                using second_mapping_self_t = std::conditional_t<std::is_lvalue_reference_v<second_self_t>, second_facade_self_t&, second_facade_self_t>;
+                using mapping_t = proxies::detail::dispatch_multi_mapping<first_facade_t, second_facade_t, func_t, first_mapping_self_t, second_mapping_self_t, return_t(args_t...)>;
+                using first_proxy_base_t = std::conditional_t<is_first_const, const proxy_base, proxy_base>;
+                using second_proxy_base_t = std::conditional_t<is_second_const, const proxy_base, proxy_base>;
+                using table_t = dispatch_multi_table<mapping_t>;
+
+                static_assert(std::is_empty_v<func_t>);
+                static_assert(std::is_empty_v<first_facade_t>);
+                static_assert(std::is_empty_v<second_facade_t>);
+
+                first_facade_self_t& first_facade = first;
+                second_facade_self_t& second_facade = second;
+                first_proxy_base_t& first_proxy = reinterpret_cast<first_proxy_base_t&>(first_facade);
+                second_proxy_base_t& second_proxy = reinterpret_cast<second_proxy_base_t&>(second_facade);
+
+                auto* first_ptr = first_proxy.ptr();
+                auto* second_ptr = second_proxy.ptr();
+
+                auto dispatch = table_t::get(first_proxy.type_index(), second_proxy.type_index());
+
+                if (dispatch == nullptr) [[unlikely]]
+                {
+                    dispatch = proxies::detail::dispatch_impl<typename mapping_t::dispatch_type>(
+                        dispatch_multi_resolve_first<mapping_t> {}, std::as_const(first_facade), std::as_const(second_facade));
+
+                    table_t::set(first_proxy.type_index(), second_proxy.type_index(), dispatch);
+                }
+
+                return dispatch(first_ptr, second_ptr, std::forward<args_t>(args)...);
+            }
+
+            // the proxy base of a facade, or of a proxy through its facade, with the constness of self
+            template <typename self_t>
+            [[nodiscard]] SPORE_PROXY_FORCE_INLINE auto& self_proxy_base(self_t& self) noexcept
+            {
+                constexpr bool is_const = std::is_const_v<self_t>;
+
+                using facade_t = typename self_facade<std::remove_const_t<self_t>>::type;
+                using facade_self_t = std::conditional_t<is_const, const facade_t, facade_t>;
+                using proxy_base_t = std::conditional_t<is_const, const proxy_base, proxy_base>;
+
+                static_assert(std::is_empty_v<facade_t>);
+
+                facade_self_t& facade = self;
+                return reinterpret_cast<proxy_base_t&>(facade);
+            }
+
+            // whether an index is the one of a value_t behind one of the library's hooked storages
+            template <typename facade_t, typename value_t>
+            [[nodiscard]] SPORE_PROXY_FORCE_INLINE bool is_hooked_type_index(const std::uint32_t type_index) noexcept
+            {
+                return [&]<typename... storages_t>(std::type_identity<std::tuple<storages_t...>>) {
+                    return (... or (type_index == proxies::detail::type_index<facade_t, hooked_value<storages_t, value_t>>()));
+                }(std::type_identity<hooked_storages> {});
+            }
+
+            // the value of a proxy if it is a value_t behind one of the library's hooked storages, after running its hook,
+            // or nullptr
+            template <typename facade_t, typename value_t, typename proxy_base_t>
+            [[nodiscard]] auto* find_hooked_value(proxy_base_t& proxy) SPORE_PROXY_THROW_SPEC
+            {
+                constexpr bool is_const = std::is_const_v<proxy_base_t>;
+
+                std::conditional_t<is_const, const void, void>* ptr = nullptr;
+
+                [&]<typename... storages_t>(std::type_identity<std::tuple<storages_t...>>) {
+                    (... or (proxy.type_index() == proxies::detail::type_index<facade_t, hooked_value<storages_t, value_t>>() and
+                             (ptr = static_cast<std::conditional_t<is_const, const storages_t, storages_t>*>(proxy.ptr())->dispatch_ptr(), true)));
+                }(std::type_identity<hooked_storages> {});
+
+                return ptr;
+            }
+
+            template <typename return_t, typename facade_t, typename proxy_base_t, typename self_t, typename func_t, typename fallback_t>
+            SPORE_PROXY_FORCE_INLINE constexpr return_t visit_known_hooked_impl(proxy_value_types<>, proxy_base_t&, self_t&& self, func_t&, fallback_t& fallback) SPORE_PROXY_THROW_SPEC
+            {
+                return static_cast<return_t>(fallback(std::forward<self_t>(self)));
+            }
+
+            template <typename return_t, typename facade_t, typename value_t, typename... values_t, typename proxy_base_t, typename self_t, typename func_t, typename fallback_t>
+            constexpr return_t visit_known_hooked_impl(proxy_value_types<value_t, values_t...>, proxy_base_t& proxy, self_t&& self, func_t& func, fallback_t& fallback) SPORE_PROXY_THROW_SPEC
+            {
+                if (auto* ptr = proxies::detail::find_hooked_value<facade_t, value_t>(proxy))
+                {
+                    return static_cast<return_t>(func(proxies::detail::dispatch_self<self_t, value_t>(ptr)));
+                }
+
+                return proxies::detail::visit_known_hooked_impl<return_t, facade_t>(proxy_value_types<values_t...> {}, proxy, std::forward<self_t>(self), func, fallback);
+            }
+
+            // values stored directly are compared first, so that hooked storages only cost the fallback
+            template <typename return_t, typename facade_t, typename known_t, typename proxy_base_t, typename self_t, typename func_t, typename fallback_t>
+            SPORE_PROXY_FORCE_INLINE constexpr return_t visit_known_impl(proxy_value_types<>, known_t, proxy_base_t& proxy, self_t&& self, func_t& func, fallback_t& fallback) SPORE_PROXY_THROW_SPEC
+            {
+                return proxies::detail::visit_known_hooked_impl<return_t, facade_t>(known_t {}, proxy, std::forward<self_t>(self), func, fallback);
+            }
+
+            template <typename return_t, typename facade_t, typename value_t, typename... values_t, typename known_t, typename proxy_base_t, typename self_t, typename func_t, typename fallback_t>
+            SPORE_PROXY_FORCE_INLINE constexpr return_t visit_known_impl(proxy_value_types<value_t, values_t...>, known_t, proxy_base_t& proxy, self_t&& self, func_t& func, fallback_t& fallback) SPORE_PROXY_THROW_SPEC
+            {
+                if (proxy.type_index() == proxies::detail::type_index<facade_t, value_t>())
+                {
+                    return static_cast<return_t>(func(proxies::detail::dispatch_self<self_t, value_t>(proxy.ptr())));
+                }
+
+                return proxies::detail::visit_known_impl<return_t, facade_t>(proxy_value_types<values_t...> {}, known_t {}, proxy, std::forward<self_t>(self), func, fallback);
             }
         }
 
@@ -329,6 +1209,68 @@ namespace spore
             return proxies::detail::dispatch_impl<return_t>(func, std::forward<self_t>(self), std::forward<args_t>(args)...);
         }
 
+        template <typename signature_t = void(), typename func_t, typename self_t>
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE constexpr auto bind(const func_t&, self_t&& self) SPORE_PROXY_THROW_SPEC
+        {
+            return proxies::detail::bind_impl<signature_t, func_t>(std::forward<self_t>(self));
+        }
+
+        template <typename return_t = void, typename func_t, typename first_self_t, typename second_self_t, typename... args_t>
+        SPORE_PROXY_FORCE_INLINE constexpr return_t dispatch_multi(const func_t& func, first_self_t&& first, second_self_t&& second, args_t&&... args) SPORE_PROXY_THROW_SPEC
+        {
+            return proxies::detail::dispatch_multi_impl<return_t>(func, std::forward<first_self_t>(first), std::forward<second_self_t>(second), std::forward<args_t>(args)...);
+        }
+
+        // whether the value of a proxy is a value_t, without dispatching. value proxies are checked directly, other proxies
+        // through their facade, e.g. *proxy
+        template <typename value_t, typename self_t>
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE bool holds(const self_t& self) noexcept
+        {
+            using facade_t = typename proxies::detail::self_facade<self_t>::type;
+
+            const std::uint32_t type_index = proxies::detail::self_proxy_base(self).type_index();
+            return type_index == proxies::detail::type_index<facade_t, value_t>() or proxies::detail::is_hooked_type_index<facade_t, value_t>(type_index);
+        }
+
+        // the value of a proxy if it is a value_t, or nullptr
+        template <typename value_t, typename self_t>
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE std::conditional_t<std::is_const_v<self_t>, const value_t, value_t>* get_if(self_t& self) SPORE_PROXY_THROW_SPEC
+        {
+            using facade_t = typename proxies::detail::self_facade<std::remove_const_t<self_t>>::type;
+            using result_t = std::conditional_t<std::is_const_v<self_t>, const value_t, value_t>;
+
+            auto& proxy = proxies::detail::self_proxy_base(self);
+
+            if (proxy.type_index() == proxies::detail::type_index<facade_t, value_t>()) [[likely]]
+            {
+                return static_cast<result_t*>(proxy.ptr());
+            }
+
+            return static_cast<result_t*>(proxies::detail::find_hooked_value<facade_t, value_t>(proxy));
+        }
+
+        // calls func with the value of a proxy if it is one of values_t, compared in order, or fallback with the proxy
+        // otherwise. the value is forwarded following the same rules as a self of dispatch
+        template <typename... values_t, typename self_t, typename func_t, typename fallback_t>
+        SPORE_PROXY_FORCE_INLINE constexpr std::invoke_result_t<fallback_t&, self_t&&> visit_known(self_t&& self, func_t&& func, fallback_t&& fallback) SPORE_PROXY_THROW_SPEC
+        {
+            using facade_t = typename proxies::detail::self_facade<std::remove_cvref_t<self_t>>::type;
+            using return_t = std::invoke_result_t<fallback_t&, self_t&&>;
+
+            auto& proxy = proxies::detail::self_proxy_base(self);
+
+            return proxies::detail::visit_known_impl<return_t, facade_t>(proxy_value_types<values_t...> {}, proxy_value_types<values_t...> {}, proxy, std::forward<self_t>(self), func, fallback);
+        }
+
+        // the function takes a proxy_return_slot<proxy_t> after its self and constructs the result with it, so that the
+        // value is constructed in the storage of the returned proxy without being moved
+        template <any_proxy proxy_t, typename func_t, typename self_t, typename... args_t>
+        SPORE_PROXY_FORCE_INLINE constexpr proxy_t dispatch_emplace(const func_t&, self_t&& self, args_t&&... args) SPORE_PROXY_THROW_SPEC
+        {
+            static_assert(std::is_empty_v<func_t>);
+            return proxies::detail::dispatch_impl<proxy_t>(proxies::detail::dispatch_emplace<func_t, proxy_t> {}, std::forward<self_t>(self), std::forward<args_t>(args)...);
+        }
+
         template <typename return_t = void, typename func_t, typename self_t, typename... args_t>
         SPORE_PROXY_FORCE_INLINE constexpr return_t dispatch_or_throw(const func_t&, self_t&& self, args_t&&... args) SPORE_PROXY_THROW_SPEC
         {
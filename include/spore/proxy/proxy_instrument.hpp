@@ -0,0 +1,768 @@
+#pragma once
+
+#include "spore/proxy/proxy_macros.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// allocations, spills to the heap, copies and moves are recorded per facade and value when SPORE_PROXY_INSTRUMENT is
+// defined, every translation unit must agree on it. otherwise the hooks expand to nothing and snapshots are empty.
+// dispatches are recorded by facades using proxy_dispatch_instrumented, regardless of the define.
+
+#ifdef SPORE_PROXY_INSTRUMENT
+#    define SPORE_PROXY_INSTRUMENT_EVENT(Event, TypeInfo, Bytes) ::spore::proxies::detail::instrument_event((Event), (TypeInfo), (Bytes))
+#    define SPORE_PROXY_INSTRUMENT_FACADE(Facade, ...) ::spore::proxies::detail::instrument_scope<Facade>::run([&]() -> decltype(auto) { return __VA_ARGS__; })
+#    define SPORE_PROXY_INSTRUMENT_FACADE_SCOPE(Facade) const ::spore::proxies::detail::instrument_scope<Facade> instrument_scope
+#else
+#    define SPORE_PROXY_INSTRUMENT_EVENT(Event, TypeInfo, Bytes) (void) 0
+#    define SPORE_PROXY_INSTRUMENT_FACADE(Facade, ...) __VA_ARGS__
+#    define SPORE_PROXY_INSTRUMENT_FACADE_SCOPE(Facade) static_assert(true)
+#endif
+
+namespace spore
+{
+    struct proxy_type_info;
+
+    enum class proxy_event : std::uint8_t
+    {
+        allocate,
+        deallocate,
+        spill,
+        copy,
+        move,
+    };
+
+    struct proxy_instrument_counts
+    {
+        std::uint64_t allocations = 0;
+        std::uint64_t allocated_bytes = 0;
+        std::uint64_t deallocations = 0;
+        std::uint64_t deallocated_bytes = 0;
+        std::uint64_t spills = 0;
+        std::uint64_t copies = 0;
+        std::uint64_t moves = 0;
+    };
+
+    // counts of a value stored by proxies of a facade, the facade is empty for storages used without a proxy
+    struct proxy_instrument_entry
+    {
+        std::string_view facade;
+        const proxy_type_info* type_info = nullptr;
+        proxy_instrument_counts counts;
+    };
+
+    // dispatches of a mapping to a value type, the mapping is named after the function object of its dispatch. local facades
+    // may share their name, the facade id tells them apart, see proxies::facade_id
+    struct proxy_dispatch_entry
+    {
+        const void* facade_id = nullptr;
+        std::string_view facade;
+        std::string_view mapping;
+        std::string_view type;
+        std::uint32_t type_index = 0;
+        std::uint64_t calls = 0;
+        std::uint64_t samples = 0;
+        std::chrono::nanoseconds sampled_time {};
+    };
+
+    // a dispatch recorded by a capture, the mapping is identified by its id in the capture's mappings
+    struct proxy_capture_record
+    {
+        std::uint32_t mapping = 0;
+        std::uint32_t type_index = 0;
+    };
+
+    struct proxy_capture_mapping
+    {
+        std::uint32_t id = 0;
+        std::string facade;
+        std::string name;
+    };
+
+    // a type is identified by the mapping it was dispatched through and its index, indices being only unique within a
+    // facade
+    struct proxy_capture_type
+    {
+        std::uint32_t mapping = 0;
+        std::uint32_t type_index = 0;
+        std::string name;
+    };
+
+    // the dispatches of each thread during a capture, in order, see proxies::capture_begin
+    struct proxy_capture
+    {
+        std::vector<proxy_capture_mapping> mappings;
+        std::vector<proxy_capture_type> types;
+        std::vector<std::vector<proxy_capture_record>> threads;
+    };
+
+    namespace proxies::detail
+    {
+        inline constexpr std::size_t cache_line_size = 64;
+
+        // the name of a type as spelled by the compiler, without its template parameter noise
+        template <typename value_t>
+        [[nodiscard]] std::string_view type_name() noexcept
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            const std::string_view name = __FUNCSIG__;
+            const std::size_t begin = name.find("type_name<") + std::string_view {"type_name<"}.size();
+            const std::size_t end = name.rfind(">(void)");
+#else
+            const std::string_view name = __PRETTY_FUNCTION__;
+            const std::size_t begin = name.find("value_t = ") + std::string_view {"value_t = "}.size();
+            const std::size_t end = std::min(name.find(';', begin), name.rfind(']'));
+#endif
+            return name.substr(begin, end - begin);
+        }
+
+        struct instrument_facade
+        {
+            std::string_view name;
+        };
+
+        template <typename facade_t>
+        const instrument_facade& instrument_facade_of() noexcept
+        {
+            static const instrument_facade facade {.name = type_name<facade_t>()};
+            return facade;
+        }
+
+        struct instrument_key
+        {
+            const instrument_facade* facade;
+            const proxy_type_info* type_info;
+
+            friend bool operator==(const instrument_key&, const instrument_key&) = default;
+        };
+
+        struct instrument_key_hash
+        {
+            std::size_t operator()(const instrument_key& key) const noexcept
+            {
+                const std::size_t facade_hash = std::hash<const void*> {}(key.facade);
+                return facade_hash ^ (std::hash<const void*> {}(key.type_info) + 0x9e3779b9 + (facade_hash << 6) + (facade_hash >> 2));
+            }
+        };
+
+        // written by its thread only, read by snapshots from any thread
+        struct instrument_counters
+        {
+            std::atomic<std::uint64_t> allocations;
+            std::atomic<std::uint64_t> allocated_bytes;
+            std::atomic<std::uint64_t> deallocations;
+            std::atomic<std::uint64_t> deallocated_bytes;
+            std::atomic<std::uint64_t> spills;
+            std::atomic<std::uint64_t> copies;
+            std::atomic<std::uint64_t> moves;
+
+            SPORE_PROXY_FORCE_INLINE static void add(std::atomic<std::uint64_t>& counter, const std::uint64_t value) noexcept
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            }
+
+            void add_to(proxy_instrument_counts& counts) const noexcept
+            {
+                counts.allocations += allocations.load(std::memory_order_relaxed);
+                counts.allocated_bytes += allocated_bytes.load(std::memory_order_relaxed);
+                counts.deallocations += deallocations.load(std::memory_order_relaxed);
+                counts.deallocated_bytes += deallocated_bytes.load(std::memory_order_relaxed);
+                counts.spills += spills.load(std::memory_order_relaxed);
+                counts.copies += copies.load(std::memory_order_relaxed);
+                counts.moves += moves.load(std::memory_order_relaxed);
+            }
+        };
+
+        using instrument_counts_map = std::unordered_map<instrument_key, proxy_instrument_counts, instrument_key_hash>;
+
+        struct instrument_mapping
+        {
+            const instrument_facade* facade_info;
+            std::string_view facade;
+            std::string_view name;
+            std::uint32_t id;
+        };
+
+        // mappings indexed by id, in the order of their first use
+        struct instrument_mappings
+        {
+            static std::mutex& mutex() noexcept
+            {
+                static std::mutex mutex;
+                return mutex;
+            }
+
+            static std::vector<std::unique_ptr<instrument_mapping>>& mappings() noexcept
+            {
+                static std::vector<std::unique_ptr<instrument_mapping>> mappings;
+                return mappings;
+            }
+
+            static const instrument_mapping& add(const instrument_facade& facade, const std::string_view name)
+            {
+                std::lock_guard lock {mutex()};
+
+                const auto id = static_cast<std::uint32_t>(mappings().size());
+                return *mappings().emplace_back(std::make_unique<instrument_mapping>(std::addressof(facade), facade.name, name, id));
+            }
+        };
+
+        template <typename mapping_t>
+        const instrument_mapping& instrument_mapping_of()
+        {
+            static const instrument_mapping& mapping = instrument_mappings::add(instrument_facade_of<typename mapping_t::facade_type>(), type_name<typename mapping_t::func_type>());
+            return mapping;
+        }
+
+        // padded, so that hot counters of one thread never share a cache line with another's
+        struct alignas(cache_line_size) instrument_dispatch_counters
+        {
+            std::atomic<std::uint64_t> calls;
+            std::atomic<std::uint64_t> samples;
+            std::atomic<std::uint64_t> sampled_nanoseconds;
+        };
+
+        struct instrument_dispatch_counts
+        {
+            std::uint64_t calls = 0;
+            std::uint64_t samples = 0;
+            std::uint64_t sampled_nanoseconds = 0;
+
+            void add(const instrument_dispatch_counters& counters) noexcept
+            {
+                calls += counters.calls.load(std::memory_order_relaxed);
+                samples += counters.samples.load(std::memory_order_relaxed);
+                sampled_nanoseconds += counters.sampled_nanoseconds.load(std::memory_order_relaxed);
+            }
+        };
+
+        struct instrument_dispatch_key
+        {
+            const instrument_mapping* mapping;
+            std::uint32_t type_index;
+
+            friend bool operator==(const instrument_dispatch_key&, const instrument_dispatch_key&) = default;
+        };
+
+        struct instrument_dispatch_key_hash
+        {
+            std::size_t operator()(const instrument_dispatch_key& key) const noexcept
+            {
+                const std::size_t mapping_hash = std::hash<const void*> {}(key.mapping);
+                return mapping_hash ^ (key.type_index + 0x9e3779b9 + (mapping_hash << 6) + (mapping_hash >> 2));
+            }
+        };
+
+        using instrument_dispatch_map = std::unordered_map<instrument_dispatch_key, instrument_dispatch_counts, instrument_dispatch_key_hash>;
+
+        // counters of a mapping indexed by type index, allocated on the first dispatch to each type
+        struct instrument_dispatch_table
+        {
+            std::uint32_t mapping_id = 0;
+            std::vector<std::unique_ptr<instrument_dispatch_counters>> counters;
+        };
+
+        inline constexpr std::size_t capture_buffer_size = 4096;
+
+        struct instrument_capture
+        {
+            static inline std::atomic<bool> active = false;
+            static inline std::atomic<std::uint64_t> epoch = 0;
+
+            // records of threads that exited during the current capture
+            static std::vector<std::vector<proxy_capture_record>>& retired() noexcept
+            {
+                static std::vector<std::vector<proxy_capture_record>> threads;
+                return threads;
+            }
+        };
+
+        // names of the values registered to instrumented dispatchers, by mapping and type index
+        struct instrument_type_names
+        {
+            static std::mutex& mutex() noexcept
+            {
+                static std::mutex mutex;
+                return mutex;
+            }
+
+            static std::unordered_map<instrument_dispatch_key, std::string_view, instrument_dispatch_key_hash>& names() noexcept
+            {
+                static std::unordered_map<instrument_dispatch_key, std::string_view, instrument_dispatch_key_hash> names;
+                return names;
+            }
+
+            static void add(const instrument_mapping& mapping, const std::uint32_t type_index, const std::string_view name)
+            {
+                std::lock_guard lock {mutex()};
+                names().insert_or_assign(instrument_dispatch_key {std::addressof(mapping), type_index}, name);
+            }
+
+            [[nodiscard]] static std::string_view find(const instrument_mapping& mapping, const std::uint32_t type_index)
+            {
+                std::lock_guard lock {mutex()};
+
+                const auto it = names().find(instrument_dispatch_key {std::addressof(mapping), type_index});
+                return it != names().end() ? it->second : std::string_view {};
+            }
+        };
+
+        struct instrument_thread
+        {
+            // the thread looks its counters up without locking, since only itself inserts, under the lock, while
+            // snapshots only read
+            std::mutex mutex;
+            std::unordered_map<instrument_key, instrument_counters, instrument_key_hash> counters;
+            std::unordered_map<const instrument_mapping*, instrument_dispatch_table> dispatch_tables;
+
+            // dispatches captured by the thread during the capture of its epoch, the buffer is filled without locking
+            // and moved to the records under the lock once full
+            std::uint64_t capture_epoch = 0;
+            std::vector<proxy_capture_record> captured;
+            std::unique_ptr<proxy_capture_record[]> capture_buffer;
+            std::atomic<std::size_t> capture_count = 0;
+
+            instrument_thread() noexcept;
+            ~instrument_thread() noexcept;
+
+            instrument_thread(const instrument_thread&) = delete;
+            instrument_thread& operator=(const instrument_thread&) = delete;
+
+            instrument_counters& find(const instrument_key& key)
+            {
+                if (const auto it = counters.find(key); it != counters.end()) [[likely]]
+                {
+                    return it->second;
+                }
+
+                std::lock_guard lock {mutex};
+                return counters.try_emplace(key).first->second;
+            }
+
+            instrument_dispatch_table& find_dispatch_table(const instrument_mapping& mapping)
+            {
+                std::lock_guard lock {mutex};
+
+                instrument_dispatch_table& table = dispatch_tables[std::addressof(mapping)];
+                table.mapping_id = mapping.id;
+                return table;
+            }
+
+            instrument_dispatch_counters& find_dispatch(instrument_dispatch_table& table, const std::uint32_t type_index)
+            {
+                if (type_index < table.counters.size() and table.counters[type_index] != nullptr) [[likely]]
+                {
+                    return *table.counters[type_index];
+                }
+
+                std::lock_guard lock {mutex};
+
+                if (type_index >= table.counters.size())
+                {
+                    table.counters.resize(type_index + 1);
+                }
+
+                table.counters[type_index] = std::make_unique<instrument_dispatch_counters>();
+                return *table.counters[type_index];
+            }
+
+            void capture(const std::uint32_t mapping_id, const std::uint32_t type_index)
+            {
+                const std::uint64_t epoch = instrument_capture::epoch.load(std::memory_order_relaxed);
+                std::size_t count = capture_count.load(std::memory_order_relaxed);
+
+                if (capture_epoch != epoch or count == capture_buffer_size) [[unlikely]]
+                {
+                    std::lock_guard lock {mutex};
+
+                    if (capture_epoch != epoch)
+                    {
+                        captured.clear();
+                        capture_epoch = epoch;
+                    }
+                    else
+                    {
+                        captured.insert(captured.end(), capture_buffer.get(), capture_buffer.get() + count);
+                    }
+
+                    if (capture_buffer == nullptr)
+                    {
+                        capture_buffer = std::make_unique_for_overwrite<proxy_capture_record[]>(capture_buffer_size);
+                    }
+
+                    count = 0;
+                    capture_count.store(count, std::memory_order_relaxed);
+                }
+
+                capture_buffer[count] = proxy_capture_record {.mapping = mapping_id, .type_index = type_index};
+                capture_count.store(count + 1, std::memory_order_release);
+            }
+
+            void add_to(std::vector<std::vector<proxy_capture_record>>& threads, const std::uint64_t epoch)
+            {
+                std::lock_guard lock {mutex};
+
+                if (capture_epoch == epoch)
+                {
+                    std::vector<proxy_capture_record>& records = threads.emplace_back(captured);
+                    records.insert(records.end(), capture_buffer.get(), capture_buffer.get() + capture_count.load(std::memory_order_acquire));
+                }
+            }
+
+            void add_to(instrument_counts_map& counts) noexcept
+            {
+                std::lock_guard lock {mutex};
+
+                for (const auto& [key, thread_counters] : counters)
+                {
+                    thread_counters.add_to(counts[key]);
+                }
+            }
+
+            void add_to(instrument_dispatch_map& counts) noexcept
+            {
+                std::lock_guard lock {mutex};
+
+                for (const auto& [mapping, table] : dispatch_tables)
+                {
+                    for (std::uint32_t type_index = 0; type_index < table.counters.size(); ++type_index)
+                    {
+                        if (table.counters[type_index] != nullptr)
+                        {
+                            counts[instrument_dispatch_key {mapping, type_index}].add(*table.counters[type_index]);
+                        }
+                    }
+                }
+            }
+
+            static std::mutex& registry_mutex() noexcept
+            {
+                static std::mutex mutex;
+                return mutex;
+            }
+
+            static std::unordered_set<instrument_thread*>& registry() noexcept
+            {
+                static std::unordered_set<instrument_thread*> threads;
+                return threads;
+            }
+
+            // counts of exited threads
+            static instrument_counts_map& retired() noexcept
+            {
+                static instrument_counts_map counts;
+                return counts;
+            }
+
+            static instrument_dispatch_map& retired_dispatches() noexcept
+            {
+                static instrument_dispatch_map counts;
+                return counts;
+            }
+
+            static instrument_thread& local() noexcept
+            {
+                static thread_local instrument_thread thread;
+                return thread;
+            }
+
+            static inline thread_local constinit const instrument_facade* current_facade = nullptr;
+        };
+
+        inline instrument_thread::instrument_thread() noexcept
+        {
+            std::lock_guard lock {registry_mutex()};
+            registry().insert(this);
+        }
+
+        inline instrument_thread::~instrument_thread() noexcept
+        {
+            std::lock_guard lock {registry_mutex()};
+            registry().erase(this);
+            add_to(retired());
+            add_to(retired_dispatches());
+            add_to(instrument_capture::retired(), instrument_capture::epoch.load(std::memory_order_relaxed));
+        }
+
+        // the first event of a facade and value allocates its counters, which terminates if it fails in a noexcept storage
+        // operation, like any other allocation there
+        inline void instrument_event(const proxy_event event, const proxy_type_info* type_info, const std::size_t bytes)
+        {
+            instrument_counters& counters = instrument_thread::local().find(instrument_key {instrument_thread::current_facade, type_info});
+
+            switch (event)
+            {
+                case proxy_event::allocate:
+                    instrument_counters::add(counters.allocations, 1);
+                    instrument_counters::add(counters.allocated_bytes, bytes);
+                    break;
+                case proxy_event::deallocate:
+                    instrument_counters::add(counters.deallocations, 1);
+                    instrument_counters::add(counters.deallocated_bytes, bytes);
+                    break;
+                case proxy_event::spill:
+                    instrument_counters::add(counters.spills, 1);
+                    break;
+                case proxy_event::copy:
+                    instrument_counters::add(counters.copies, 1);
+                    break;
+                case proxy_event::move:
+                    instrument_counters::add(counters.moves, 1);
+                    break;
+            }
+        }
+
+        // attributes the events of storage operations to the facade of the proxy running them
+        template <typename facade_t>
+        struct instrument_scope
+        {
+            const instrument_facade* previous = std::exchange(instrument_thread::current_facade, std::addressof(instrument_facade_of<facade_t>()));
+
+            instrument_scope() = default;
+
+            instrument_scope(const instrument_scope&) = delete;
+            instrument_scope& operator=(const instrument_scope&) = delete;
+
+            ~instrument_scope() noexcept
+            {
+                instrument_thread::current_facade = previous;
+            }
+
+            template <typename func_t>
+            static decltype(auto) run(const func_t& func)
+            {
+                const instrument_scope scope;
+                return func();
+            }
+        };
+    }
+
+    namespace proxies
+    {
+        // identifies a facade in dispatch snapshots, unlike its name which local facades may share
+        template <typename facade_t>
+        [[nodiscard]] const void* facade_id() noexcept
+        {
+            return std::addressof(detail::instrument_facade_of<facade_t>());
+        }
+
+        // sums the counts of every thread, including exited ones
+        inline std::vector<proxy_instrument_entry> instrument_snapshot()
+        {
+            using namespace proxies::detail;
+
+            instrument_counts_map counts;
+
+            {
+                std::lock_guard lock {instrument_thread::registry_mutex()};
+
+                counts = instrument_thread::retired();
+
+                for (instrument_thread* thread : instrument_thread::registry())
+                {
+                    thread->add_to(counts);
+                }
+            }
+
+            std::vector<proxy_instrument_entry> entries;
+            entries.reserve(counts.size());
+
+            for (const auto& [key, key_counts] : counts)
+            {
+                entries.emplace_back() = proxy_instrument_entry {
+                    .facade = key.facade != nullptr ? key.facade->name : std::string_view {},
+                    .type_info = key.type_info,
+                    .counts = key_counts,
+                };
+            }
+
+            return entries;
+        }
+
+        // sums the dispatches of every thread through instrumented dispatchers, including exited threads
+        inline std::vector<proxy_dispatch_entry> dispatch_snapshot()
+        {
+            using namespace proxies::detail;
+
+            instrument_dispatch_map counts;
+
+            {
+                std::lock_guard lock {instrument_thread::registry_mutex()};
+
+                counts = instrument_thread::retired_dispatches();
+
+                for (instrument_thread* thread : instrument_thread::registry())
+                {
+                    thread->add_to(counts);
+                }
+            }
+
+            std::vector<proxy_dispatch_entry> entries;
+            entries.reserve(counts.size());
+
+            for (const auto& [key, key_counts] : counts)
+            {
+                entries.emplace_back() = proxy_dispatch_entry {
+                    .facade_id = key.mapping->facade_info,
+                    .facade = key.mapping->facade,
+                    .mapping = key.mapping->name,
+                    .type = instrument_type_names::find(*key.mapping, key.type_index),
+                    .type_index = key.type_index,
+                    .calls = key_counts.calls,
+                    .samples = key_counts.samples,
+                    .sampled_time = std::chrono::nanoseconds {key_counts.sampled_nanoseconds},
+                };
+            }
+
+            return entries;
+        }
+
+        // starts recording the dispatches of facades using an instrumented dispatcher, discarding the previous capture
+        inline void capture_begin()
+        {
+            using namespace proxies::detail;
+
+            std::lock_guard lock {instrument_thread::registry_mutex()};
+
+            instrument_capture::retired().clear();
+            instrument_capture::epoch.fetch_add(1, std::memory_order_relaxed);
+            instrument_capture::active.store(true, std::memory_order_relaxed);
+        }
+
+        inline void capture_end() noexcept
+        {
+            proxies::detail::instrument_capture::active.store(false, std::memory_order_relaxed);
+        }
+
+        // the dispatches of the current or last capture, threads that did not dispatch are left out
+        inline proxy_capture capture_snapshot()
+        {
+            using namespace proxies::detail;
+
+            proxy_capture capture;
+
+            {
+                std::lock_guard lock {instrument_thread::registry_mutex()};
+
+                const std::uint64_t epoch = instrument_capture::epoch.load(std::memory_order_relaxed);
+                capture.threads = instrument_capture::retired();
+
+                for (instrument_thread* thread : instrument_thread::registry())
+                {
+                    thread->add_to(capture.threads, epoch);
+                }
+            }
+
+            std::erase_if(capture.threads, [](const std::vector<proxy_capture_record>& records) { return records.empty(); });
+
+            std::lock_guard lock {instrument_mappings::mutex()};
+
+            for (const std::unique_ptr<instrument_mapping>& mapping : instrument_mappings::mappings())
+            {
+                capture.mappings.emplace_back() = proxy_capture_mapping {
+                    .id = mapping->id,
+                    .facade = std::string {mapping->facade},
+                    .name = std::string {mapping->name},
+                };
+            }
+
+            std::unordered_set<instrument_dispatch_key, instrument_dispatch_key_hash> types;
+
+            for (const std::vector<proxy_capture_record>& records : capture.threads)
+            {
+                for (const proxy_capture_record& record : records)
+                {
+                    const instrument_mapping& mapping = *instrument_mappings::mappings()[record.mapping];
+
+                    if (types.insert(instrument_dispatch_key {std::addressof(mapping), record.type_index}).second)
+                    {
+                        capture.types.emplace_back() = proxy_capture_type {
+                            .mapping = record.mapping,
+                            .type_index = record.type_index,
+                            .name = std::string {instrument_type_names::find(mapping, record.type_index)},
+                        };
+                    }
+                }
+            }
+
+            return capture;
+        }
+
+        // writes a header specializing proxy_dispatch_profile with the hot_count values dispatched to most by each facade,
+        // facades and values that cannot be named from a header, such as local types, are skipped
+        inline std::string dispatch_profile_header(const std::span<const proxy_dispatch_entry> entries, const std::size_t hot_count = 2)
+        {
+            struct hot_value
+            {
+                std::string_view type;
+                std::uint64_t calls = 0;
+            };
+
+            const auto is_nameable = [](const std::string_view name) {
+                return not name.empty() and name.find_first_of("(){}") == std::string_view::npos;
+            };
+
+            std::vector<std::pair<std::string_view, std::vector<hot_value>>> facades;
+
+            for (const proxy_dispatch_entry& entry : entries)
+            {
+                if (not is_nameable(entry.facade) or not is_nameable(entry.type))
+                {
+                    continue;
+                }
+
+                auto facade = std::ranges::find(facades, entry.facade, &std::pair<std::string_view, std::vector<hot_value>>::first);
+
+                if (facade == facades.end())
+                {
+                    facade = facades.insert(facade, {entry.facade, {}});
+                }
+
+                auto value = std::ranges::find(facade->second, entry.type, &hot_value::type);
+
+                if (value == facade->second.end())
+                {
+                    value = facade->second.insert(value, hot_value {.type = entry.type});
+                }
+
+                value->calls += entry.calls;
+            }
+
+            std::ranges::sort(facades, {}, &std::pair<std::string_view, std::vector<hot_value>>::first);
+
+            std::string header = "#pragma once\n\n// generated by spore::proxies::dispatch_profile_header from a profiling run\n";
+
+            for (auto& [facade, values] : facades)
+            {
+                std::ranges::stable_sort(values, std::ranges::greater {}, &hot_value::calls);
+
+                header += "\ntemplate <>\nstruct spore::proxy_dispatch_profile<";
+                header += facade;
+                header += "> : spore::proxy_dispatch_hot<";
+
+                for (std::size_t index = 0; index < std::min(hot_count, values.size()); ++index)
+                {
+                    header += index != 0 ? ", " : "";
+                    header += values[index].type;
+                }
+
+                header += ">\n{\n};\n";
+            }
+
+            return header;
+        }
+    }
+}
\ No newline at end of file
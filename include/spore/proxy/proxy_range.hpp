@@ -0,0 +1,171 @@
+#pragma once
+
+#include "spore/proxy/proxy.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <utility>
+
+namespace spore
+{
+    // a source of values, the implementation fills a chunk at a time so that a dispatch is amortised over the chunk
+    template <typename value_t>
+    struct proxy_range_facade : proxy_facade<proxy_range_facade<value_t>>
+    {
+        // fills the chunk from its front and returns the number of values written, zero once the source is exhausted
+        std::size_t next_chunk(const std::span<value_t> chunk)
+        {
+            constexpr auto func = [](auto& self, const std::span<value_t> chunk) { return self.next_chunk(chunk); };
+            return proxies::dispatch<std::size_t>(func, *this, chunk);
+        }
+    };
+
+    namespace proxies::detail
+    {
+        template <typename value_t, std::ranges::input_range range_t>
+        struct range_source
+        {
+            explicit range_source(range_t&& range)
+                : _range(std::move(range)),
+                  _it(std::ranges::begin(_range)),
+                  _end(std::ranges::end(_range))
+            {
+            }
+
+            std::size_t next_chunk(const std::span<value_t> chunk)
+            {
+                if constexpr (std::sized_sentinel_for<std::ranges::sentinel_t<range_t>, std::ranges::iterator_t<range_t>>)
+                {
+                    const auto count = std::min(static_cast<std::ptrdiff_t>(chunk.size()), static_cast<std::ptrdiff_t>(_end - _it));
+                    _it = std::ranges::copy_n(std::move(_it), count, chunk.begin()).in;
+                    return static_cast<std::size_t>(count);
+                }
+                else
+                {
+                    std::size_t count = 0;
+
+                    for (; count < chunk.size() and _it != _end; ++count, ++_it)
+                    {
+                        chunk[count] = *_it;
+                    }
+
+                    return count;
+                }
+            }
+
+            range_t _range;
+            std::ranges::iterator_t<range_t> _it;
+            std::ranges::sentinel_t<range_t> _end;
+        };
+    }
+
+    // single-pass input range over a type erased source, values are read from the source a chunk at a time into a
+    // buffer owned by the range, and the range outlives its iterators
+    template <typename value_t, std::size_t chunk_size_v = 256>
+    struct proxy_range
+    {
+        static_assert(chunk_size_v != 0);
+        static_assert(std::is_default_constructible_v<value_t>);
+
+        using facade_type = proxy_range_facade<value_t>;
+        using proxy_type = unique_proxy<facade_type>;
+
+        struct iterator
+        {
+            using value_type = value_t;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            [[nodiscard]] value_t& operator*() const noexcept
+            {
+                return *_current;
+            }
+
+            iterator& operator++() SPORE_PROXY_THROW_SPEC
+            {
+                if (++_current == _end) [[unlikely]]
+                {
+                    _range->next_chunk(*this);
+                }
+
+                return *this;
+            }
+
+            void operator++(int) SPORE_PROXY_THROW_SPEC
+            {
+                ++*this;
+            }
+
+            [[nodiscard]] friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept
+            {
+                return it._current == it._end;
+            }
+
+          private:
+            friend proxy_range;
+
+            explicit iterator(proxy_range* range) noexcept
+                : _range(range)
+            {
+            }
+
+            proxy_range* _range = nullptr;
+            value_t* _current = nullptr;
+            value_t* _end = nullptr;
+        };
+
+        explicit proxy_range(proxy_type source)
+            : _source(std::move(source)),
+              _chunk(std::make_unique<value_t[]>(chunk_size_v))
+        {
+        }
+
+        proxy_range(proxy_range&&) noexcept = default;
+        proxy_range& operator=(proxy_range&&) noexcept = default;
+
+        // reads the first chunk, the range is single-pass so it is called once
+        [[nodiscard]] iterator begin() SPORE_PROXY_THROW_SPEC
+        {
+            iterator it {this};
+            next_chunk(it);
+            return it;
+        }
+
+        [[nodiscard]] std::default_sentinel_t end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+
+      private:
+        void next_chunk(iterator& it) SPORE_PROXY_THROW_SPEC
+        {
+            const std::size_t count = _source->next_chunk(std::span<value_t> {_chunk.get(), chunk_size_v});
+
+            SPORE_PROXY_ASSERT(count <= chunk_size_v);
+
+            it._current = _chunk.get();
+            it._end = _chunk.get() + count;
+        }
+
+        proxy_type _source;
+        std::unique_ptr<value_t[]> _chunk;
+    };
+
+    namespace proxies
+    {
+        // erases an input range whose values convert to value_t, an l-value range is referenced and an r-value range is
+        // moved into the source
+        template <typename value_t, std::size_t chunk_size_v = 256, std::ranges::viewable_range range_t>
+            requires(std::ranges::input_range<range_t> and std::convertible_to<std::ranges::range_reference_t<range_t>, value_t>)
+        [[nodiscard]] proxy_range<value_t, chunk_size_v> make_range(range_t&& range) SPORE_PROXY_THROW_SPEC
+        {
+            using source_t = proxies::detail::range_source<value_t, std::views::all_t<range_t>>;
+            return proxy_range<value_t, chunk_size_v> {proxies::make_unique<proxy_range_facade<value_t>, source_t>(std::views::all(std::forward<range_t>(range)))};
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "spore/proxy/proxy_instrument.hpp"
+#include "spore/proxy/proxy_macros.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace spore
+{
+    // a facade as registered so far by its proxies, mappings are named after the function object of their dispatch
+    struct proxy_registry_facade
+    {
+        std::string_view name;
+        std::string_view dispatcher;
+        std::vector<std::string_view> bases;
+        std::vector<std::string_view> values;
+        std::vector<std::string_view> mappings;
+    };
+
+    // the dispatch table of a mapping, thread-local tables are listed once per live thread and shared ones without a thread
+    struct proxy_registry_table
+    {
+        std::string_view facade;
+        std::string_view mapping;
+        std::string_view dispatcher;
+        std::thread::id thread;
+        std::size_t size = 0;
+        std::size_t fill = 0;
+        std::size_t bytes = 0;
+    };
+
+    // the tables of a dispatcher summed over every mapping and thread
+    struct proxy_registry_dispatcher
+    {
+        std::string_view name;
+        std::size_t tables = 0;
+        std::size_t size = 0;
+        std::size_t fill = 0;
+        std::size_t bytes = 0;
+    };
+
+    struct proxy_registry_snapshot
+    {
+        std::vector<proxy_registry_facade> facades;
+        std::vector<proxy_registry_dispatcher> dispatchers;
+        std::vector<proxy_registry_table> tables;
+    };
+
+    namespace proxies::detail
+    {
+        struct registry_facade
+        {
+            std::string_view dispatcher;
+            std::vector<const instrument_facade*> bases;
+            std::vector<std::string_view> values;
+            std::vector<std::string_view> mappings;
+        };
+
+        struct registry_table
+        {
+            using describe_type = void (*)(const void* entries, proxy_registry_table& table) noexcept;
+
+            const instrument_mapping* mapping;
+            std::string_view dispatcher;
+            std::thread::id thread;
+            const void* entries;
+            describe_type describe;
+            std::mutex* mutex;
+
+            template <typename dispatch_t, typename mapping_t>
+            [[nodiscard]] static registry_table of(const void* entries, const std::thread::id thread, const describe_type describe) noexcept
+            {
+                return registry_table {
+                    .mapping = std::addressof(instrument_mapping_of<mapping_t>()),
+                    .dispatcher = type_name<dispatch_t>(),
+                    .thread = thread,
+                    .entries = entries,
+                    .describe = describe,
+                    .mutex = nullptr,
+                };
+            }
+
+            template <typename func_t>
+            static void describe_entries(const func_t* entries, const std::size_t size, const std::size_t capacity, proxy_registry_table& table) noexcept
+            {
+                table.size = size;
+                table.fill = static_cast<std::size_t>(std::count_if(entries, entries + size, [](const func_t func) { return func != nullptr; }));
+                table.bytes = capacity * sizeof(func_t);
+            }
+        };
+
+        // registration state of every translation unit, written once per registration. dispatch tables are only listed
+        // and unlisted under this lock, and are written under their own lock, so that snapshots can read tables of other
+        // threads without every registration contending on a single lock
+        struct registry
+        {
+            static std::mutex& mutex() noexcept
+            {
+                static std::mutex mutex;
+                return mutex;
+            }
+
+            static std::unordered_map<const instrument_facade*, registry_facade>& facades() noexcept
+            {
+                static std::unordered_map<const instrument_facade*, registry_facade> facades;
+                return facades;
+            }
+
+            static std::unordered_map<const void*, registry_table>& tables() noexcept
+            {
+                static std::unordered_map<const void*, registry_table> tables;
+                return tables;
+            }
+
+            template <typename dispatch_t, typename facade_t>
+            static registry_facade& find()
+            {
+                registry_facade& facade = facades()[std::addressof(instrument_facade_of<facade_t>())];
+                facade.dispatcher = type_name<dispatch_t>();
+                return facade;
+            }
+
+            template <typename value_t>
+            static void insert(std::vector<value_t>& values, const value_t value)
+            {
+                if (std::find(values.begin(), values.end(), value) == values.end())
+                {
+                    values.push_back(value);
+                }
+            }
+        };
+
+        template <typename dispatch_t, typename facade_t, typename value_t>
+        void registry_add_value()
+        {
+            std::lock_guard lock {registry::mutex()};
+            registry::insert(registry::find<dispatch_t, facade_t>().values, type_name<value_t>());
+        }
+
+        template <typename dispatch_t, typename facade_t, typename mapping_t>
+        void registry_add_mapping()
+        {
+            std::lock_guard lock {registry::mutex()};
+            registry::insert(registry::find<dispatch_t, facade_t>().mappings, instrument_mapping_of<mapping_t>().name);
+        }
+
+        template <typename dispatch_t, typename facade_t, typename base_facade_t>
+        void registry_add_base()
+        {
+            std::lock_guard lock {registry::mutex()};
+            registry::insert(registry::find<dispatch_t, facade_t>().bases, std::addressof(instrument_facade_of<base_facade_t>()));
+        }
+
+        // lists a dispatch table for as long as the guard lives, it must be destroyed before the table. dispatchers write
+        // the table while holding lock()
+        struct registry_table_guard
+        {
+            const void* entries;
+            mutable std::mutex mutex;
+
+            explicit registry_table_guard(registry_table table)
+                : entries(table.entries)
+            {
+                table.mutex = std::addressof(mutex);
+
+                std::lock_guard lock {registry::mutex()};
+                registry::tables().insert_or_assign(entries, table);
+            }
+
+            registry_table_guard(const registry_table_guard&) = delete;
+            registry_table_guard& operator=(const registry_table_guard&) = delete;
+
+            ~registry_table_guard() noexcept
+            {
+                std::lock_guard lock {registry::mutex()};
+                registry::tables().erase(entries);
+            }
+
+            [[nodiscard]] std::unique_lock<std::mutex> lock() const noexcept
+            {
+                return std::unique_lock {mutex};
+            }
+        };
+    }
+
+    namespace proxies
+    {
+        // lists the facades, values and mappings registered so far, along with the dispatch tables of every live thread
+        inline proxy_registry_snapshot registry_snapshot()
+        {
+            using namespace proxies::detail;
+
+            proxy_registry_snapshot snapshot;
+
+            std::lock_guard lock {registry::mutex()};
+
+            snapshot.facades.reserve(registry::facades().size());
+
+            for (const auto& [facade, entry] : registry::facades())
+            {
+                proxy_registry_facade& snapshot_facade = snapshot.facades.emplace_back();
+                snapshot_facade.name = facade->name;
+                snapshot_facade.dispatcher = entry.dispatcher;
+                snapshot_facade.values = entry.values;
+                snapshot_facade.mappings = entry.mappings;
+
+                for (const instrument_facade* base : entry.bases)
+                {
+                    snapshot_facade.bases.push_back(base->name);
+                }
+            }
+
+            snapshot.tables.reserve(registry::tables().size());
+
+            for (const auto& [entries, table] : registry::tables())
+            {
+                proxy_registry_table& snapshot_table = snapshot.tables.emplace_back();
+                snapshot_table.facade = table.mapping->facade;
+                snapshot_table.mapping = table.mapping->name;
+                snapshot_table.dispatcher = table.dispatcher;
+                snapshot_table.thread = table.thread;
+
+                {
+                    std::lock_guard table_lock {*table.mutex};
+                    table.describe(entries, snapshot_table);
+                }
+
+                auto dispatcher = std::ranges::find(snapshot.dispatchers, table.dispatcher, &proxy_registry_dispatcher::name);
+
+                if (dispatcher == snapshot.dispatchers.end())
+                {
+                    dispatcher = snapshot.dispatchers.insert(dispatcher, proxy_registry_dispatcher {.name = table.dispatcher});
+                }
+
+                dispatcher->tables += 1;
+                dispatcher->size += snapshot_table.size;
+                dispatcher->fill += snapshot_table.fill;
+                dispatcher->bytes += snapshot_table.bytes;
+            }
+
+            std::ranges::sort(snapshot.facades, {}, &proxy_registry_facade::name);
+            std::ranges::sort(snapshot.dispatchers, {}, &proxy_registry_dispatcher::name);
+
+            return snapshot;
+        }
+    }
+}
\ No newline at end of file
@@ -1,13 +1,24 @@
 #pragma once
 
+#include "spore/proxy/proxy_concepts.hpp"
+#include "spore/proxy/proxy_counter.hpp"
+#include "spore/proxy/proxy_instrument.hpp"
 #include "spore/proxy/proxy_macros.hpp"
 #include "spore/proxy/proxy_type_info.hpp"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
 #include <optional>
+#include <span>
+#include <tuple>
 #include <utility>
 #include <variant>
 
@@ -46,6 +57,8 @@ namespace spore
 
                 _type_info = std::addressof(proxies::detail::type_info<value_t>());
                 _ptr = new value_t {std::forward<args_t>(args)...};
+
+                SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::allocate, _type_info, sizeof(value_t));
             }
 
             template <typename storage_t>
@@ -73,7 +86,7 @@ namespace spore
                 SPORE_PROXY_ASSERT(_ptr == nullptr);
 
                 _type_info = std::addressof(type_info);
-                _ptr = type_info.allocate();
+                _ptr = proxies::detail::allocate(type_info);
 
                 type_info.move(_ptr, ptr);
             }
@@ -84,9 +97,9 @@ namespace spore
                 SPORE_PROXY_ASSERT(_ptr == nullptr);
 
                 _type_info = std::addressof(type_info);
-                _ptr = type_info.allocate();
+                _ptr = proxies::detail::allocate(type_info);
 
-                type_info.copy(_ptr, ptr);
+                proxies::detail::copy(type_info, _ptr, ptr);
             }
 
             void destroy() noexcept
@@ -94,8 +107,8 @@ namespace spore
                 SPORE_PROXY_ASSERT(_type_info != nullptr);
                 SPORE_PROXY_ASSERT(_ptr != nullptr);
 
-                _type_info->destroy(_ptr);
-                _type_info->deallocate(_ptr);
+                proxies::detail::destroy(*_type_info, _ptr);
+                proxies::detail::deallocate(*_type_info, _ptr);
 
                 _type_info = nullptr;
                 _ptr = nullptr;
@@ -106,30 +119,33 @@ namespace spore
         };
     }
 
-    template <typename counter_t>
+    template <typename counter_t, bool padded_v = false>
     struct proxy_storage_shared
     {
+        // the value is allocated right after a header holding its counter and type info, so that the storage is a single
+        // pointer to the value. padding moves the value to its own cache line, away from a contended counter.
+        //   the header also counts weak references, with all strong references counting as one, the value is destroyed
+        //   with the last strong reference and its block is freed with the last weak reference.
+
+        struct weak_storage;
+
         proxy_storage_shared() = default;
 
         template <typename value_t, typename... args_t>
         explicit proxy_storage_shared(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
         {
-            shared_block<value_t>* block = new shared_block<value_t> {std::forward<args_t>(args)...};
-
-            _type_info = std::addressof(proxies::detail::type_info<value_t>());
-            _block = block;
-            _ptr = std::addressof(block->value);
+            construct(proxies::detail::type_info<value_t>(), [&](void* ptr) {
+                ::new (ptr) value_t {std::forward<args_t>(args)...};
+            });
         }
 
         proxy_storage_shared(const proxy_storage_shared& other) noexcept
         {
-            _type_info = other._type_info;
-            _block = other._block;
             _ptr = other._ptr;
 
-            if (_type_info != nullptr)
+            if (_ptr != nullptr)
             {
-                ++counter();
+                counter_traits_t::increment(counter());
             }
         }
 
@@ -144,19 +160,12 @@ namespace spore
 
         proxy_storage_shared(proxy_storage_shared&& other) noexcept
         {
-            _type_info = other._type_info;
-            _block = other._block;
             _ptr = other._ptr;
-
-            other._type_info = nullptr;
-            other._block = nullptr;
             other._ptr = nullptr;
         }
 
         proxy_storage_shared& operator=(proxy_storage_shared&& other) noexcept
         {
-            std::swap(_type_info, other._type_info);
-            std::swap(_block, other._block);
             std::swap(_ptr, other._ptr);
 
             return *this;
@@ -169,24 +178,20 @@ namespace spore
 
         void reset() noexcept
         {
-            if (_type_info != nullptr)
+            if (_ptr != nullptr)
             {
-                if (--counter() == 0)
+                if (counter_traits_t::decrement(counter()))
                 {
-                    SPORE_PROXY_ASSERT(_block != nullptr);
-
-                    delete _block;
+                    release(_ptr);
                 }
 
-                _type_info = nullptr;
-                _block = nullptr;
                 _ptr = nullptr;
             }
         }
 
         [[nodiscard]] const proxy_type_info* type_info() const noexcept
         {
-            return _type_info;
+            return _ptr != nullptr ? header_of(_ptr)->type_info : nullptr;
         }
 
         [[nodiscard]] void* ptr() const noexcept
@@ -196,358 +201,1644 @@ namespace spore
 
         [[nodiscard]] counter_t& counter() noexcept
         {
-            SPORE_PROXY_ASSERT(_block != nullptr);
-            return _block->counter;
+            SPORE_PROXY_ASSERT(_ptr != nullptr);
+            return header_of(_ptr)->counter;
         }
 
-      private:
-        struct shared_block_base
-        {
-            counter_t counter;
-            virtual ~shared_block_base() = default;
-        };
+      protected:
+        using counter_traits_t = proxies::detail::counter_traits<counter_t>;
+        using weak_counter_t = std::conditional_t<std::is_same_v<counter_t, std::uint32_t>, std::uint32_t, std::atomic<std::uint32_t>>;
+        using weak_counter_traits_t = proxies::detail::counter_traits<weak_counter_t>;
 
-        template <typename value_t>
-        struct shared_block : shared_block_base
+        struct shared_header
         {
-            value_t value;
-
-            template <typename... args_t>
-            explicit shared_block(args_t&&... args)
-                : shared_block_base(), value {std::forward<args_t>(args)...}
-            {
-                shared_block_base::counter = 1;
-            }
+            counter_t counter;
+            weak_counter_t weak_counter;
+            const proxy_type_info* type_info;
         };
 
-        const proxy_type_info* _type_info = nullptr;
-        shared_block_base* _block = nullptr;
-        void* _ptr = nullptr;
-    };
-
-    struct proxy_storage_unique : proxies::detail::proxy_allocation_base
-    {
-        proxy_storage_unique() = default;
+        static_assert(std::is_standard_layout_v<shared_header>);
+        static_assert(std::is_trivially_destructible_v<counter_t>);
 
-        template <typename value_t, typename... args_t>
-        explicit proxy_storage_unique(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
+        [[nodiscard]] static constexpr std::size_t block_alignment(const proxy_type_info& type_info) noexcept
         {
-            in_place_construct<value_t>(std::forward<args_t>(args)...);
+            constexpr std::size_t header_alignment = padded_v ? std::max(alignof(shared_header), proxies::detail::cache_line_size) : alignof(shared_header);
+            return std::max(header_alignment, type_info.alignment);
         }
 
-        proxy_storage_unique(proxy_storage_unique&& other) noexcept
+        [[nodiscard]] static constexpr std::size_t header_offset(const proxy_type_info& type_info) noexcept
         {
-            _type_info = other._type_info;
-            _ptr = other._ptr;
-
-            other._type_info = nullptr;
-            other._ptr = nullptr;
+            const std::size_t alignment = block_alignment(type_info);
+            return (sizeof(shared_header) + alignment - 1) / alignment * alignment;
         }
 
-        proxy_storage_unique(const proxy_storage_unique& other) = delete;
-        proxy_storage_unique& operator=(const proxy_storage_unique& other) = delete;
-
-        ~proxy_storage_unique() noexcept
+        [[nodiscard]] static shared_header* header_of(const void* ptr) noexcept
         {
-            reset();
+            return reinterpret_cast<shared_header*>(const_cast<std::byte*>(static_cast<const std::byte*>(ptr)) - sizeof(shared_header));
         }
 
-        proxy_storage_unique& operator=(proxy_storage_unique&& other) noexcept
+        [[nodiscard]] static void* allocate(const proxy_type_info& type_info) SPORE_PROXY_THROW_SPEC
         {
-            std::swap(_type_info, other._type_info);
-            std::swap(_ptr, other._ptr);
+            const std::size_t offset = header_offset(type_info);
+            const std::size_t alignment = block_alignment(type_info);
 
-            return *this;
-        }
-    };
+            SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::allocate, std::addressof(type_info), offset + type_info.size);
 
-    struct proxy_storage_value : proxies::detail::proxy_allocation_base
-    {
-        proxy_storage_value() = default;
+            void* block = alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__
+                              ? ::operator new(offset + type_info.size, std::align_val_t {alignment})
+                              : ::operator new(offset + type_info.size);
 
-        template <typename storage_t>
-        constexpr explicit proxy_storage_value(storage_t&& storage) noexcept
-            requires(any_proxy_storage<std::decay_t<storage_t>>)
-        {
-            storage_construct(std::forward<storage_t>(storage));
+            return static_cast<std::byte*>(block) + offset;
         }
 
-        template <typename value_t, typename... args_t>
-        explicit proxy_storage_value(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
+        static void deallocate(const proxy_type_info& type_info, void* ptr) noexcept
         {
-            in_place_construct<value_t>(std::forward<args_t>(args)...);
-        }
+            void* block = static_cast<std::byte*>(ptr) - header_offset(type_info);
+            const std::size_t alignment = block_alignment(type_info);
 
-        proxy_storage_value(proxy_storage_value&& other) noexcept
-        {
-            if (const proxy_type_info* type_info = other.type_info())
+            SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::deallocate, std::addressof(type_info), header_offset(type_info) + type_info.size);
+
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
             {
-                move_construct(*type_info, other.ptr());
+                ::operator delete(block, std::align_val_t {alignment});
             }
-        }
-
-        proxy_storage_value(const proxy_storage_value& other) SPORE_PROXY_THROW_SPEC
-        {
-            if (const proxy_type_info* type_info = other.type_info())
+            else
             {
-                copy_construct(*type_info, other.ptr());
+                ::operator delete(block);
             }
         }
 
-        ~proxy_storage_value() noexcept
+        static void release(void* ptr) noexcept
         {
-            reset();
+            const proxy_type_info& type_info = *header_of(ptr)->type_info;
+
+            proxies::detail::destroy(type_info, ptr);
+            release_weak(ptr);
         }
 
-        proxy_storage_value& operator=(proxy_storage_value&& other) noexcept
+        static void release_weak(void* ptr) noexcept
         {
-            reset();
+            shared_header* header = header_of(ptr);
 
-            if (const proxy_type_info* type_info = other.type_info())
+            // without weak references, no other thread can observe the block anymore and the decrement can be skipped
+            if constexpr (std::is_same_v<weak_counter_t, std::uint32_t>)
             {
-                move_construct(*type_info, other.ptr());
+                if (not weak_counter_traits_t::decrement(header->weak_counter))
+                {
+                    return;
+                }
+            }
+            else if (header->weak_counter.load(std::memory_order_acquire) != 1 and
+                     header->weak_counter.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return;
             }
 
-            return *this;
+            deallocate(*header->type_info, ptr);
         }
 
-        proxy_storage_value& operator=(const proxy_storage_value& other) SPORE_PROXY_THROW_SPEC
+        static void dispose(counter_t& counter) noexcept
         {
-            reset();
+            // counters may release their value on their own, e.g. when merging biased counts
+            release(reinterpret_cast<std::byte*>(std::addressof(counter)) + sizeof(shared_header));
+        }
 
-            if (const proxy_type_info* type_info = other.type_info())
+        template <typename func_t>
+        void construct(const proxy_type_info& type_info, const func_t& func) SPORE_PROXY_THROW_SPEC
+        {
+            struct allocation_guard
             {
-                copy_construct(*type_info, other.ptr());
-            }
+                const proxy_type_info& type_info;
+                void* ptr;
 
-            return *this;
-        }
+                ~allocation_guard() noexcept
+                {
+                    if (ptr != nullptr)
+                    {
+                        deallocate(type_info, ptr);
+                    }
+                }
+            };
 
-        [[nodiscard]] static constexpr bool is_constructible(const proxy_type_info&)
-        {
-            return true;
+            SPORE_PROXY_ASSERT(_ptr == nullptr);
+
+            void* ptr = allocate(type_info);
+
+            allocation_guard guard {type_info, ptr};
+            func(ptr);
+            guard.ptr = nullptr;
+
+            shared_header* header = ::new (header_of(ptr)) shared_header {.counter = {}, .weak_counter = 1, .type_info = std::addressof(type_info)};
+            counter_traits_t::init(header->counter, &proxy_storage_shared::dispose);
+
+            _ptr = ptr;
         }
+
+        void* _ptr = nullptr;
     };
 
-    struct proxy_storage_non_owning
+    template <typename counter_t, bool padded_v>
+    struct proxy_storage_shared<counter_t, padded_v>::weak_storage
     {
-        proxy_storage_non_owning() = default;
+        // refers to the block of a shared storage without keeping its value alive, locking it increments the strong
+        // count only while it is not zero, which is a compare and swap loop for atomic counters
 
-        template <typename value_t>
-        constexpr explicit proxy_storage_non_owning(std::in_place_type_t<value_t>, SPORE_PROXY_LIFETIME_BOUND value_t& value) noexcept
+        static_assert(not std::is_same_v<counter_t, proxy_counter_biased>, "biased counters cannot be locked from other threads");
+
+        weak_storage() = default;
+
+        explicit weak_storage(const proxy_storage_shared& storage) noexcept
+            : _ptr(storage._ptr)
         {
-            _type_info = std::addressof(proxies::detail::type_info<value_t>());
-            _ptr = std::addressof(value);
+            if (_ptr != nullptr)
+            {
+                weak_counter_traits_t::increment(header_of(_ptr)->weak_counter);
+            }
         }
 
-        template <typename value_t>
-        constexpr explicit proxy_storage_non_owning(std::in_place_type_t<value_t>, SPORE_PROXY_LIFETIME_BOUND value_t&& value) noexcept
+        weak_storage(const weak_storage& other) noexcept
         {
-            _type_info = std::addressof(proxies::detail::type_info<value_t>());
-            _ptr = std::addressof(value);
+            _ptr = other._ptr;
+
+            if (_ptr != nullptr)
+            {
+                weak_counter_traits_t::increment(header_of(_ptr)->weak_counter);
+            }
         }
 
-        template <typename value_t>
-        constexpr explicit proxy_storage_non_owning(std::in_place_type_t<value_t>, SPORE_PROXY_LIFETIME_BOUND const value_t& value) noexcept
+        weak_storage& operator=(const weak_storage& other) noexcept
         {
-            _type_info = std::addressof(proxies::detail::type_info<value_t>());
-            _ptr = std::addressof(const_cast<value_t&>(value));
+            // the copy takes its weak reference before this one is released, so that self-assignment keeps the block
+            weak_storage copy {other};
+            std::swap(_ptr, copy._ptr);
+
+            return *this;
         }
 
-        template <typename storage_t>
-        constexpr explicit proxy_storage_non_owning(SPORE_PROXY_LIFETIME_BOUND storage_t&& storage) noexcept
-            requires(any_proxy_storage<std::decay_t<storage_t>>)
+        weak_storage(weak_storage&& other) noexcept
         {
-            _type_info = storage.type_info();
-            _ptr = storage.ptr();
+            _ptr = other._ptr;
+            other._ptr = nullptr;
         }
 
-        constexpr void reset() noexcept
+        weak_storage& operator=(weak_storage&& other) noexcept
         {
-            _type_info = nullptr;
-            _ptr = nullptr;
+            std::swap(_ptr, other._ptr);
+
+            return *this;
         }
 
-        [[nodiscard]] constexpr const proxy_type_info* type_info() const noexcept
+        ~weak_storage() noexcept
         {
-            return _type_info;
+            reset();
         }
 
-        [[nodiscard]] constexpr void* ptr() const noexcept
+        void reset() noexcept
         {
-            return _ptr;
+            if (_ptr != nullptr)
+            {
+                release_weak(_ptr);
+                _ptr = nullptr;
+            }
         }
 
-        [[nodiscard]] static constexpr bool is_constructible(const proxy_type_info&)
+        // an empty storage once the value is destroyed
+        [[nodiscard]] proxy_storage_shared lock() const noexcept
         {
-            return true;
+            proxy_storage_shared storage;
+
+            if (_ptr != nullptr and try_increment(header_of(_ptr)->counter))
+            {
+                storage._ptr = _ptr;
+            }
+
+            return storage;
+        }
+
+        [[nodiscard]] bool expired() const noexcept
+        {
+            if (_ptr == nullptr)
+            {
+                return true;
+            }
+
+            if constexpr (std::is_same_v<counter_t, std::uint32_t>)
+            {
+                return header_of(_ptr)->counter == 0;
+            }
+            else
+            {
+                return header_of(_ptr)->counter.load(std::memory_order_relaxed) == 0;
+            }
         }
 
       private:
-        const proxy_type_info* _type_info = nullptr;
+        [[nodiscard]] static bool try_increment(counter_t& counter) noexcept
+        {
+            if constexpr (std::is_same_v<counter_t, std::uint32_t>)
+            {
+                if (counter == 0)
+                {
+                    return false;
+                }
+
+                ++counter;
+                return true;
+            }
+            else
+            {
+                std::uint32_t count = counter.load(std::memory_order_relaxed);
+
+                while (count != 0)
+                {
+                    if (counter.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+        }
+
         void* _ptr = nullptr;
     };
 
-    template <typename value_t>
-    struct proxy_storage_inline
+    struct proxy_storage_cow : proxy_storage_shared<std::atomic<std::uint32_t>>
     {
-        proxy_storage_inline() = default;
+        // shares its value on copy, like a shared storage, but clones it before it is mutated while shared, so that
+        // copies still behave like values
 
-        template <typename... args_t>
-        constexpr explicit proxy_storage_inline(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
-        {
-            _storage.emplace(std::forward<args_t>(args)...);
-        }
+        using proxy_storage_shared::proxy_storage_shared;
 
         template <typename storage_t>
-        constexpr explicit proxy_storage_inline(storage_t&& storage) noexcept
-            requires(any_proxy_storage<std::decay_t<storage_t>>)
+        explicit proxy_storage_cow(storage_t&& storage) SPORE_PROXY_THROW_SPEC
+            requires(any_proxy_storage<std::decay_t<storage_t>> and not std::is_same_v<std::decay_t<storage_t>, proxy_storage_cow>)
         {
             if (const proxy_type_info* type_info = storage.type_info())
             {
-                SPORE_PROXY_ASSERT(proxy_storage_inline::is_constructible(*type_info));
-
                 if constexpr (std::is_rvalue_reference_v<storage_t&&> and std::is_move_constructible_v<std::decay_t<storage_t>>)
                 {
-                    type_info->move(ptr(), storage.ptr());
+                    construct(*type_info, [&](void* ptr) { type_info->move(ptr, storage.ptr()); });
                 }
                 else
                 {
                     static_assert(std::is_copy_constructible_v<std::decay_t<storage_t>>);
 
-                    type_info->copy(ptr(), storage.ptr());
+                    construct(*type_info, [&](void* ptr) { proxies::detail::copy(*type_info, ptr, storage.ptr()); });
                 }
             }
         }
 
-        void reset() noexcept
+        // clones the value if it is shared with another storage, the value can then be mutated without being observed by
+        // other storages
+        void detach() SPORE_PROXY_THROW_SPEC
         {
-            _storage = std::nullopt;
+            if (_ptr != nullptr and counter().load(std::memory_order_acquire) != 1)
+            {
+                const proxy_type_info& type_info = *header_of(_ptr)->type_info;
+
+                proxy_storage_cow storage;
+                storage.construct(type_info, [&](void* ptr) { proxies::detail::copy(type_info, ptr, _ptr); });
+
+                std::swap(_ptr, storage._ptr);
+            }
         }
 
-        [[nodiscard]] constexpr const proxy_type_info* type_info() const noexcept
+        // a mutable dispatch clones a shared value first, see proxies::detail::hooked_storage
+        [[nodiscard]] void* dispatch_ptr() SPORE_PROXY_THROW_SPEC
         {
-            return std::addressof(proxies::detail::type_info<value_t>());
+            detach();
+            return _ptr;
         }
 
-        [[nodiscard]] constexpr void* ptr() const noexcept
+        [[nodiscard]] const void* dispatch_ptr() const noexcept
         {
-            return _storage.has_value() ? std::addressof(_storage.value()) : nullptr;
+            return _ptr;
         }
 
-        [[nodiscard]] static constexpr bool is_constructible(const proxy_type_info& type_info)
+        [[nodiscard]] void* value_ptr() const noexcept
         {
-            return std::addressof(type_info) == std::addressof(proxies::detail::type_info<value_t>());
+            return _ptr;
         }
 
-      private:
-        mutable std::optional<value_t> _storage;
+        [[nodiscard]] static constexpr bool is_constructible(const proxy_type_info&)
+        {
+            return true;
+        }
     };
 
-    template <std::size_t size_v, std::size_t align_v = alignof(void*)>
-    struct proxy_storage_sbo
+    struct proxy_adopt_t
     {
-        static_assert(size_v > 0);
-        static_assert(align_v > 0);
+        explicit proxy_adopt_t() = default;
+    };
 
-        template <typename value_t>
-        static consteval bool is_constructible()
-        {
-            return sizeof(value_t) <= size_v and align_v % alignof(value_t) == 0;
-        }
+    inline constexpr proxy_adopt_t proxy_adopt {};
 
-        proxy_storage_sbo() = default;
+    struct proxy_storage_intrusive
+    {
+        // the value embeds its own counter, through proxy_intrusive_add_ref and proxy_intrusive_release, the latter being
+        // responsible for destroying the value once its count reaches zero
 
-        template <typename value_t, typename... args_t>
-        constexpr explicit proxy_storage_sbo(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
-            requires(is_constructible<value_t>())
+        proxy_storage_intrusive() = default;
+
+        template <any_proxy_intrusive value_t, typename... args_t>
+        explicit proxy_storage_intrusive(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
         {
-            _type_info = std::addressof(proxies::detail::type_info<value_t>());
+            value_t* value = new value_t {std::forward<args_t>(args)...};
+            proxy_intrusive_add_ref(*value);
 
-            std::construct_at(static_cast<value_t*>(ptr()), std::forward<args_t>(args)...);
+            _ptr = value;
+            _ops = std::addressof(intrusive_ops_of<value_t>());
         }
 
-        template <typename storage_t>
-        constexpr explicit proxy_storage_sbo(storage_t&& storage) noexcept
-            requires(any_proxy_storage<std::decay_t<storage_t>>)
+        template <any_proxy_intrusive value_t>
+        explicit proxy_storage_intrusive(std::in_place_type_t<value_t>, proxy_adopt_t, value_t* value) noexcept
         {
-            if (const proxy_type_info* type_info = storage.type_info())
+            if (value != nullptr)
             {
-                SPORE_PROXY_ASSERT(proxy_storage_sbo::is_constructible(*type_info));
-
-                _type_info = type_info;
-
-                if constexpr (std::is_rvalue_reference_v<storage_t&&> and std::is_move_constructible_v<std::decay_t<storage_t>>)
-                {
-                    _type_info->move(ptr(), storage.ptr());
-                }
-                else
-                {
-                    static_assert(std::is_copy_constructible_v<std::decay_t<storage_t>>);
+                proxy_intrusive_add_ref(*value);
 
-                    _type_info->copy(ptr(), storage.ptr());
-                }
+                _ptr = value;
+                _ops = std::addressof(intrusive_ops_of<value_t>());
             }
         }
 
-        constexpr proxy_storage_sbo(const proxy_storage_sbo& other) SPORE_PROXY_THROW_SPEC
+        proxy_storage_intrusive(const proxy_storage_intrusive& other) noexcept
         {
-            _type_info = other._type_info;
+            _ptr = other._ptr;
+            _ops = other._ops;
 
-            if (_type_info != nullptr)
+            if (_ptr != nullptr)
             {
-                _type_info->copy(ptr(), other.ptr());
+                _ops->add_ref(_ptr);
             }
         }
 
-        constexpr proxy_storage_sbo(proxy_storage_sbo&& other) noexcept
+        proxy_storage_intrusive& operator=(const proxy_storage_intrusive& other) noexcept
         {
-            _type_info = other._type_info;
+            reset();
 
-            if (_type_info != nullptr)
-            {
-                _type_info->move(ptr(), other.ptr());
-            }
+            *this = proxy_storage_intrusive {other};
+
+            return *this;
+        }
+
+        proxy_storage_intrusive(proxy_storage_intrusive&& other) noexcept
+        {
+            _ptr = other._ptr;
+            _ops = other._ops;
+
+            other._ptr = nullptr;
+            other._ops = nullptr;
+        }
+
+        proxy_storage_intrusive& operator=(proxy_storage_intrusive&& other) noexcept
+        {
+            std::swap(_ptr, other._ptr);
+            std::swap(_ops, other._ops);
+
+            return *this;
+        }
+
+        ~proxy_storage_intrusive() noexcept
+        {
+            reset();
+        }
+
+        void reset() noexcept
+        {
+            if (_ptr != nullptr)
+            {
+                _ops->release(_ptr);
+
+                _ptr = nullptr;
+                _ops = nullptr;
+            }
+        }
+
+        [[nodiscard]] const proxy_type_info* type_info() const noexcept
+        {
+            return _ops != nullptr ? _ops->type_info : nullptr;
+        }
+
+        [[nodiscard]] void* ptr() const noexcept
+        {
+            return _ptr;
+        }
+
+      private:
+        struct intrusive_ops
+        {
+            const proxy_type_info* type_info;
+            void (*add_ref)(void*) noexcept;
+            void (*release)(void*) noexcept;
+        };
+
+        template <any_proxy_intrusive value_t>
+        static const intrusive_ops& intrusive_ops_of() noexcept
+        {
+            // clang-format off
+            static const intrusive_ops ops {
+                .type_info = std::addressof(proxies::detail::type_info<value_t>()),
+                .add_ref = [](void* ptr) noexcept { proxy_intrusive_add_ref(*static_cast<value_t*>(ptr)); },
+                .release = [](void* ptr) noexcept { proxy_intrusive_release(*static_cast<value_t*>(ptr)); },
+            };
+            // clang-format on
+
+            return ops;
+        }
+
+        void* _ptr = nullptr;
+        const intrusive_ops* _ops = nullptr;
+    };
+
+    struct proxy_storage_unique
+    {
+        // the value is released through a static table of its type info and deleter, so that adopted pointers keep
+        // their deleter without growing the storage
+
+        proxy_storage_unique() = default;
+
+        template <typename value_t, typename... args_t>
+        explicit proxy_storage_unique(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
+        {
+            _ptr = new value_t {std::forward<args_t>(args)...};
+            _ops = std::addressof(unique_ops_of<value_t, std::default_delete<value_t>>());
+        }
+
+        template <typename value_t, typename deleter_t>
+        explicit proxy_storage_unique(std::in_place_type_t<value_t>, proxy_adopt_t, std::unique_ptr<value_t, deleter_t>&& value) noexcept
+        {
+            static_assert(not std::is_array_v<value_t>);
+            static_assert(std::is_same_v<typename std::unique_ptr<value_t, deleter_t>::pointer, value_t*>);
+            static_assert(std::is_empty_v<deleter_t> and std::is_default_constructible_v<deleter_t>, "stateful deleters cannot be adopted");
+
+            if (value != nullptr)
+            {
+                _ptr = value.release();
+                _ops = std::addressof(unique_ops_of<value_t, deleter_t>());
+            }
+        }
+
+        proxy_storage_unique(proxy_storage_unique&& other) noexcept
+        {
+            _ptr = other._ptr;
+            _ops = other._ops;
+
+            other._ptr = nullptr;
+            other._ops = nullptr;
+        }
+
+        proxy_storage_unique(const proxy_storage_unique& other) = delete;
+        proxy_storage_unique& operator=(const proxy_storage_unique& other) = delete;
+
+        ~proxy_storage_unique() noexcept
+        {
+            reset();
+        }
+
+        proxy_storage_unique& operator=(proxy_storage_unique&& other) noexcept
+        {
+            std::swap(_ptr, other._ptr);
+            std::swap(_ops, other._ops);
+
+            return *this;
+        }
+
+        void reset() noexcept
+        {
+            if (_ptr != nullptr)
+            {
+                _ops->release(_ptr);
+
+                _ptr = nullptr;
+                _ops = nullptr;
+            }
+        }
+
+        [[nodiscard]] const proxy_type_info* type_info() const noexcept
+        {
+            return _ops != nullptr ? _ops->type_info : nullptr;
+        }
+
+        [[nodiscard]] void* ptr() const noexcept
+        {
+            return _ptr;
+        }
+
+      private:
+        struct unique_ops
+        {
+            const proxy_type_info* type_info;
+            void (*release)(void*) noexcept;
+        };
+
+        template <typename value_t, typename deleter_t>
+        static const unique_ops& unique_ops_of() noexcept
+        {
+            // clang-format off
+            static const unique_ops ops {
+                .type_info = std::addressof(proxies::detail::type_info<value_t>()),
+                .release = [](void* ptr) noexcept { deleter_t {}(static_cast<value_t*>(ptr)); },
+            };
+            // clang-format on
+
+            return ops;
+        }
+
+        void* _ptr = nullptr;
+        const unique_ops* _ops = nullptr;
+    };
+
+    struct proxy_storage_shared_ptr
+    {
+        // shares the control block of a std::shared_ptr, so that values owned by existing shared pointers can be adopted
+        // without being moved
+
+        proxy_storage_shared_ptr() = default;
+
+        template <typename value_t, typename... args_t>
+        explicit proxy_storage_shared_ptr(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
+            : _value(std::make_shared<value_t>(std::forward<args_t>(args)...)),
+              _type_info(std::addressof(proxies::detail::type_info<value_t>()))
+        {
+        }
+
+        template <typename value_t>
+        explicit proxy_storage_shared_ptr(std::in_place_type_t<value_t>, proxy_adopt_t, std::shared_ptr<value_t>&& value) noexcept
+            : _value(std::move(value)),
+              _type_info(std::addressof(proxies::detail::type_info<value_t>()))
+        {
+        }
+
+        void reset() noexcept
+        {
+            _value.reset();
+        }
+
+        [[nodiscard]] const proxy_type_info* type_info() const noexcept
+        {
+            return _value != nullptr ? _type_info : nullptr;
+        }
+
+        [[nodiscard]] void* ptr() const noexcept
+        {
+            return _value.get();
+        }
+
+        [[nodiscard]] long use_count() const noexcept
+        {
+            return _value.use_count();
+        }
+
+      private:
+        std::shared_ptr<void> _value;
+        const proxy_type_info* _type_info = nullptr;
+    };
+
+    // owns a value constructed in a buffer provided by the caller, which must outlive the storage, so that values whose
+    // size is only known at runtime can be stored without allocating
+    struct proxy_storage_external
+    {
+        proxy_storage_external() = default;
+
+        template <typename value_t, typename... args_t>
+        explicit proxy_storage_external(std::in_place_type_t<value_t>, const std::span<std::byte> buffer, args_t&&... args) SPORE_PROXY_THROW_SPEC
+        {
+            const proxy_type_info& type_info = proxies::detail::type_info<value_t>();
+
+            if (not is_constructible(buffer, type_info)) [[unlikely]]
+            {
+                SPORE_PROXY_THROW("buffer too small");
+            }
+
+            std::construct_at(reinterpret_cast<value_t*>(buffer.data()), std::forward<args_t>(args)...);
+
+            _type_info = std::addressof(type_info);
+            _buffer = buffer;
+        }
+
+        template <typename storage_t>
+        explicit proxy_storage_external(const std::span<std::byte> buffer, storage_t&& storage) SPORE_PROXY_THROW_SPEC
+            requires(any_proxy_storage<std::decay_t<storage_t>>)
+        {
+            if (const proxy_type_info* type_info = storage.type_info())
+            {
+                if (not is_constructible(buffer, *type_info)) [[unlikely]]
+                {
+                    SPORE_PROXY_THROW("buffer too small");
+                }
+
+                if constexpr (std::is_rvalue_reference_v<storage_t&&> and std::is_move_constructible_v<std::decay_t<storage_t>>)
+                {
+                    type_info->move(buffer.data(), storage.ptr());
+                }
+                else
+                {
+                    static_assert(std::is_copy_constructible_v<std::decay_t<storage_t>>);
+
+                    proxies::detail::copy(*type_info, buffer.data(), storage.ptr());
+                }
+
+                _type_info = type_info;
+                _buffer = buffer;
+            }
+        }
+
+        proxy_storage_external(proxy_storage_external&& other) noexcept
+            : _type_info(std::exchange(other._type_info, nullptr)),
+              _buffer(std::exchange(other._buffer, {}))
+        {
+        }
+
+        proxy_storage_external(const proxy_storage_external& other) = delete;
+        proxy_storage_external& operator=(const proxy_storage_external& other) = delete;
+
+        ~proxy_storage_external() noexcept
+        {
+            reset();
+        }
+
+        proxy_storage_external& operator=(proxy_storage_external&& other) noexcept
+        {
+            std::swap(_type_info, other._type_info);
+            std::swap(_buffer, other._buffer);
+
+            return *this;
+        }
+
+        // destroys the value, the buffer is left to the caller
+        void reset() noexcept
+        {
+            if (_type_info != nullptr)
+            {
+                proxies::detail::destroy(*_type_info, _buffer.data());
+
+                _type_info = nullptr;
+                _buffer = {};
+            }
+        }
+
+        [[nodiscard]] const proxy_type_info* type_info() const noexcept
+        {
+            return _type_info;
+        }
+
+        [[nodiscard]] void* ptr() const noexcept
+        {
+            return _type_info != nullptr ? _buffer.data() : nullptr;
+        }
+
+        [[nodiscard]] std::span<std::byte> buffer() const noexcept
+        {
+            return _buffer;
+        }
+
+        [[nodiscard]] static bool is_constructible(const std::span<const std::byte> buffer, const proxy_type_info& type_info) noexcept
+        {
+            return type_info.size <= buffer.size() and reinterpret_cast<std::uintptr_t>(buffer.data()) % type_info.alignment == 0;
+        }
+
+      private:
+        const proxy_type_info* _type_info = nullptr;
+        std::span<std::byte> _buffer;
+    };
+
+    template <bool mt_v = false>
+    struct proxy_storage_lazy
+    {
+        // captures the constructor arguments and allocates the value on its first dispatch. the multi-threaded variant
+        // lets a single thread construct the value while other threads wait for it.
+        //   state: nullptr, constructing (mt only), or the value
+
+        static constexpr std::size_t args_size = 4 * sizeof(void*);
+
+        proxy_storage_lazy() = default;
+
+        template <typename value_t, typename... args_t>
+        explicit proxy_storage_lazy(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
+        {
+            using args_tuple_t = std::tuple<std::decay_t<args_t>...>;
+
+            if constexpr (is_inline<args_tuple_t>())
+            {
+                ::new (std::addressof(_args[0])) args_tuple_t {std::forward<args_t>(args)...};
+            }
+            else
+            {
+                ::new (std::addressof(_args[0])) args_tuple_t* {new args_tuple_t {std::forward<args_t>(args)...}};
+            }
+
+            _ops = std::addressof(lazy_ops_of<value_t, args_tuple_t>());
+        }
+
+        proxy_storage_lazy(proxy_storage_lazy&& other) noexcept
+        {
+            relocate(other);
+        }
+
+        proxy_storage_lazy(const proxy_storage_lazy& other) = delete;
+        proxy_storage_lazy& operator=(const proxy_storage_lazy& other) = delete;
+
+        ~proxy_storage_lazy() noexcept
+        {
+            reset();
+        }
+
+        proxy_storage_lazy& operator=(proxy_storage_lazy&& other) noexcept
+        {
+            if (this != std::addressof(other))
+            {
+                reset();
+                relocate(other);
+            }
+
+            return *this;
+        }
+
+        void reset() noexcept
+        {
+            if (_ops != nullptr)
+            {
+                if (void* value = load())
+                {
+                    _ops->release(value);
+                }
+                else
+                {
+                    _ops->destroy_args(std::addressof(_args[0]));
+                }
+
+                _ops = nullptr;
+                store(nullptr);
+            }
+        }
+
+        [[nodiscard]] const proxy_type_info* type_info() const noexcept
+        {
+            return _ops != nullptr ? _ops->type_info : nullptr;
+        }
+
+        // constructs the value if it hasn't been yet
+        [[nodiscard]] void* ptr() const SPORE_PROXY_THROW_SPEC
+        {
+            if (void* value = load()) [[likely]]
+            {
+                return value;
+            }
+
+            return _ops != nullptr ? construct() : nullptr;
+        }
+
+        [[nodiscard]] bool is_constructed() const noexcept
+        {
+            return load() != nullptr;
+        }
+
+        // every dispatch constructs the value if needed, see proxies::detail::hooked_storage
+        [[nodiscard]] void* dispatch_ptr() const SPORE_PROXY_THROW_SPEC
+        {
+            return ptr();
+        }
+
+        // the value if it was constructed, without constructing it
+        [[nodiscard]] void* value_ptr() const noexcept
+        {
+            return load();
+        }
+
+      private:
+        using state_t = std::conditional_t<mt_v, std::atomic<std::uintptr_t>, std::uintptr_t>;
+
+        static constexpr std::uintptr_t constructing_state = 1;
+
+        struct lazy_ops
+        {
+            const proxy_type_info* type_info;
+            void* (*construct)(void*);
+            void (*destroy_args)(void*) noexcept;
+            void (*relocate_args)(void*, void*) noexcept;
+            void (*release)(void*) noexcept;
+        };
+
+        template <typename args_tuple_t>
+        [[nodiscard]] static consteval bool is_inline()
+        {
+            return sizeof(args_tuple_t) <= args_size and alignof(std::max_align_t) % alignof(args_tuple_t) == 0 and
+                   std::is_nothrow_move_constructible_v<args_tuple_t>;
+        }
+
+        // arguments that don't fit in the buffer are boxed on the heap
+        template <typename args_tuple_t>
+        [[nodiscard]] static args_tuple_t* args_of(void* ptr) noexcept
+        {
+            if constexpr (is_inline<args_tuple_t>())
+            {
+                return std::launder(static_cast<args_tuple_t*>(ptr));
+            }
+            else
+            {
+                return *std::launder(static_cast<args_tuple_t**>(ptr));
+            }
+        }
+
+        template <typename args_tuple_t>
+        static void destroy_args(void* ptr) noexcept
+        {
+            if constexpr (is_inline<args_tuple_t>())
+            {
+                std::destroy_at(args_of<args_tuple_t>(ptr));
+            }
+            else
+            {
+                delete args_of<args_tuple_t>(ptr);
+            }
+        }
+
+        template <typename value_t, typename args_tuple_t>
+        static const lazy_ops& lazy_ops_of() noexcept
+        {
+            // clang-format off
+            static const lazy_ops ops {
+                .type_info = std::addressof(proxies::detail::type_info<value_t>()),
+                .construct = [](void* ptr) SPORE_PROXY_THROW_SPEC -> void* {
+                    void* value = std::apply([](auto&... args) { return new value_t {std::move(args)...}; }, *args_of<args_tuple_t>(ptr));
+                    destroy_args<args_tuple_t>(ptr);
+                    return value;
+                },
+                .destroy_args = &destroy_args<args_tuple_t>,
+                .relocate_args = [](void* ptr, void* other_ptr) noexcept {
+                    if constexpr (is_inline<args_tuple_t>())
+                    {
+                        ::new (ptr) args_tuple_t {std::move(*args_of<args_tuple_t>(other_ptr))};
+                        std::destroy_at(args_of<args_tuple_t>(other_ptr));
+                    }
+                    else
+                    {
+                        ::new (ptr) args_tuple_t* {args_of<args_tuple_t>(other_ptr)};
+                    }
+                },
+                .release = [](void* ptr) noexcept { delete static_cast<value_t*>(ptr); },
+            };
+            // clang-format on
+
+            return ops;
+        }
+
+        const lazy_ops* _ops = nullptr;
+        mutable state_t _state {};
+        alignas(std::max_align_t) mutable std::array<std::byte, args_size> _args;
+
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE void* load() const noexcept
+        {
+            std::uintptr_t state;
+
+            if constexpr (mt_v)
+            {
+                state = _state.load(std::memory_order_acquire);
+            }
+            else
+            {
+                state = _state;
+            }
+
+            return state > constructing_state ? reinterpret_cast<void*>(state) : nullptr;
+        }
+
+        void store(void* value) const noexcept
+        {
+            if constexpr (mt_v)
+            {
+                _state.store(reinterpret_cast<std::uintptr_t>(value), std::memory_order_release);
+                _state.notify_all();
+            }
+            else
+            {
+                _state = reinterpret_cast<std::uintptr_t>(value);
+            }
+        }
+
+        void* construct() const SPORE_PROXY_THROW_SPEC
+        {
+            if constexpr (mt_v)
+            {
+                // the arguments are moved into the value, so a single thread may construct it, a failed construction
+                // lets another thread try again
+                struct construction_guard
+                {
+                    const proxy_storage_lazy& storage;
+                    bool constructed = false;
+
+                    ~construction_guard() noexcept
+                    {
+                        if (not constructed)
+                        {
+                            storage.store(nullptr);
+                        }
+                    }
+                };
+
+                std::uintptr_t state = _state.load(std::memory_order_acquire);
+
+                while (state <= constructing_state)
+                {
+                    if (state == constructing_state)
+                    {
+                        _state.wait(state, std::memory_order_acquire);
+                        state = _state.load(std::memory_order_acquire);
+                    }
+                    else if (_state.compare_exchange_weak(state, constructing_state, std::memory_order_acquire, std::memory_order_acquire))
+                    {
+                        construction_guard guard {*this};
+                        void* value = _ops->construct(std::addressof(_args[0]));
+                        guard.constructed = true;
+
+                        store(value);
+                        return value;
+                    }
+                }
+
+                return reinterpret_cast<void*>(state);
+            }
+            else
+            {
+                void* value = _ops->construct(std::addressof(_args[0]));
+                store(value);
+                return value;
+            }
+        }
+
+        void relocate(proxy_storage_lazy& other) noexcept
+        {
+            SPORE_PROXY_ASSERT(_ops == nullptr);
+
+            if (other._ops != nullptr)
+            {
+                void* value = other.load();
+
+                if (value == nullptr)
+                {
+                    other._ops->relocate_args(std::addressof(_args[0]), std::addressof(other._args[0]));
+                }
+
+                _ops = std::exchange(other._ops, nullptr);
+
+                store(value);
+                other.store(nullptr);
+            }
+        }
+    };
+
+    namespace proxies::detail
+    {
+        // a storage that must act before each dispatch, e.g. to clone or construct its value. a proxy of such a storage
+        // points to the storage and registers its value as a hooked_value, so that only the dispatch functions of hooked
+        // values run the hook, and dispatches of other proxies don't test for it
+        template <typename storage_t>
+        concept hooked_storage = requires(storage_t& storage, const storage_t& const_storage) {
+            { storage.dispatch_ptr() } -> std::same_as<void*>;
+            { const_storage.dispatch_ptr() } -> std::convertible_to<const void*>;
+            { const_storage.value_ptr() } -> std::same_as<void*>;
+        };
+
+        template <typename storage_t, typename value_t>
+        struct hooked_value
+        {
+            using storage_type = storage_t;
+            using value_type = value_t;
+        };
+
+        template <typename value_t>
+        struct unhooked_value
+        {
+            using type = value_t;
+        };
+
+        template <typename storage_t, typename value_t>
+        struct unhooked_value<hooked_value<storage_t, value_t>>
+        {
+            using type = value_t;
+        };
+
+        template <typename value_t>
+        using unhooked_value_t = typename unhooked_value<value_t>::type;
+
+        // the type a value is registered with when stored in a storage_t
+        template <typename storage_t, typename value_t>
+        using stored_value_t = std::conditional_t<hooked_storage<storage_t>, hooked_value<storage_t, value_t>, value_t>;
+
+        // the hooked storages of the library, proxies::holds and get_if look for a value behind each of them
+        using hooked_storages = std::tuple<proxy_storage_cow, proxy_storage_lazy<false>, proxy_storage_lazy<true>>;
+    }
+
+    struct proxy_storage_value : proxies::detail::proxy_allocation_base
+    {
+        proxy_storage_value() = default;
+
+        template <typename storage_t>
+        constexpr explicit proxy_storage_value(storage_t&& storage) noexcept
+            requires(any_proxy_storage<std::decay_t<storage_t>>)
+        {
+            storage_construct(std::forward<storage_t>(storage));
+        }
+
+        template <typename value_t, typename... args_t>
+        explicit proxy_storage_value(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
+        {
+            in_place_construct<value_t>(std::forward<args_t>(args)...);
+        }
+
+        proxy_storage_value(proxy_storage_value&& other) noexcept
+        {
+            if (const proxy_type_info* type_info = other.type_info())
+            {
+                move_construct(*type_info, other.ptr());
+            }
+        }
+
+        proxy_storage_value(const proxy_storage_value& other) SPORE_PROXY_THROW_SPEC
+        {
+            if (const proxy_type_info* type_info = other.type_info())
+            {
+                copy_construct(*type_info, other.ptr());
+            }
+        }
+
+        ~proxy_storage_value() noexcept
+        {
+            reset();
+        }
+
+        proxy_storage_value& operator=(proxy_storage_value&& other) noexcept
+        {
+            reset();
+
+            if (const proxy_type_info* type_info = other.type_info())
+            {
+                move_construct(*type_info, other.ptr());
+            }
+
+            return *this;
+        }
+
+        proxy_storage_value& operator=(const proxy_storage_value& other) SPORE_PROXY_THROW_SPEC
+        {
+            reset();
+
+            if (const proxy_type_info* type_info = other.type_info())
+            {
+                copy_construct(*type_info, other.ptr());
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] static constexpr bool is_constructible(const proxy_type_info&)
+        {
+            return true;
+        }
+    };
+
+    struct proxy_storage_non_owning
+    {
+        proxy_storage_non_owning() = default;
+
+        template <typename value_t>
+        constexpr explicit proxy_storage_non_owning(std::in_place_type_t<value_t>, SPORE_PROXY_LIFETIME_BOUND value_t& value) noexcept
+        {
+            _type_info = std::addressof(proxies::detail::type_info<value_t>());
+            _ptr = std::addressof(value);
+        }
+
+        template <typename value_t>
+        constexpr explicit proxy_storage_non_owning(std::in_place_type_t<value_t>, SPORE_PROXY_LIFETIME_BOUND value_t&& value) noexcept
+        {
+            _type_info = std::addressof(proxies::detail::type_info<value_t>());
+            _ptr = std::addressof(value);
+        }
+
+        template <typename value_t>
+        constexpr explicit proxy_storage_non_owning(std::in_place_type_t<value_t>, SPORE_PROXY_LIFETIME_BOUND const value_t& value) noexcept
+        {
+            _type_info = std::addressof(proxies::detail::type_info<value_t>());
+            _ptr = std::addressof(const_cast<value_t&>(value));
+        }
+
+        template <typename storage_t>
+        constexpr explicit proxy_storage_non_owning(SPORE_PROXY_LIFETIME_BOUND storage_t&& storage) noexcept
+            requires(any_proxy_storage<std::decay_t<storage_t>>)
+        {
+            _type_info = storage.type_info();
+            _ptr = storage.ptr();
+        }
+
+        constexpr void reset() noexcept
+        {
+            _type_info = nullptr;
+            _ptr = nullptr;
+        }
+
+        [[nodiscard]] constexpr const proxy_type_info* type_info() const noexcept
+        {
+            return _type_info;
+        }
+
+        [[nodiscard]] constexpr void* ptr() const noexcept
+        {
+            return _ptr;
+        }
+
+        [[nodiscard]] static constexpr bool is_constructible(const proxy_type_info&)
+        {
+            return true;
+        }
+
+      private:
+        const proxy_type_info* _type_info = nullptr;
+        void* _ptr = nullptr;
+    };
+
+    template <typename value_t>
+    struct proxy_storage_inline
+    {
+        proxy_storage_inline() = default;
+
+        template <typename... args_t>
+        constexpr explicit proxy_storage_inline(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
+        {
+            std::construct_at(value(), std::forward<args_t>(args)...);
+            _has_value = true;
+        }
+
+        template <typename storage_t>
+        constexpr explicit proxy_storage_inline(storage_t&& storage) noexcept
+            requires(any_proxy_storage<std::decay_t<storage_t>>)
+        {
+            if (const proxy_type_info* type_info = storage.type_info())
+            {
+                SPORE_PROXY_ASSERT(proxy_storage_inline::is_constructible(*type_info));
+
+                if constexpr (std::is_rvalue_reference_v<storage_t&&> and std::is_move_constructible_v<std::decay_t<storage_t>>)
+                {
+                    type_info->move(value(), storage.ptr());
+                }
+                else
+                {
+                    static_assert(std::is_copy_constructible_v<std::decay_t<storage_t>>);
+
+                    type_info->copy(value(), storage.ptr());
+                }
+
+                _has_value = true;
+            }
+        }
+
+        constexpr proxy_storage_inline(const proxy_storage_inline& other) SPORE_PROXY_THROW_SPEC
+            requires(std::is_copy_constructible_v<value_t>)
+        {
+            copy(other);
+        }
+
+        constexpr proxy_storage_inline(proxy_storage_inline&& other) noexcept(is_nothrow_relocatable)
+            requires(std::is_move_constructible_v<value_t> or proxy_trivially_relocatable_v<value_t>)
+        {
+            relocate(other);
+        }
+
+        constexpr ~proxy_storage_inline() noexcept
+        {
+            reset();
+        }
+
+        constexpr proxy_storage_inline& operator=(const proxy_storage_inline& other) SPORE_PROXY_THROW_SPEC
+            requires(std::is_copy_constructible_v<value_t>)
+        {
+            if (this != std::addressof(other))
+            {
+                reset();
+                copy(other);
+            }
+
+            return *this;
+        }
+
+        constexpr proxy_storage_inline& operator=(proxy_storage_inline&& other) noexcept(is_nothrow_relocatable)
+            requires(std::is_move_constructible_v<value_t> or proxy_trivially_relocatable_v<value_t>)
+        {
+            if (this != std::addressof(other))
+            {
+                reset();
+                relocate(other);
+            }
+
+            return *this;
+        }
+
+        void reset() noexcept
+        {
+            if (_has_value)
+            {
+                std::destroy_at(value());
+                _has_value = false;
+            }
+        }
+
+        [[nodiscard]] constexpr const proxy_type_info* type_info() const noexcept
+        {
+            return std::addressof(proxies::detail::type_info<value_t>());
+        }
+
+        [[nodiscard]] constexpr void* ptr() const noexcept
+        {
+            return _has_value ? value() : nullptr;
+        }
+
+        [[nodiscard]] static constexpr bool is_constructible(const proxy_type_info& type_info)
+        {
+            return std::addressof(type_info) == std::addressof(proxies::detail::type_info<value_t>());
+        }
+
+      private:
+        static constexpr bool is_nothrow_relocatable = proxy_trivially_relocatable_v<value_t> or std::is_nothrow_move_constructible_v<value_t>;
+
+        alignas(value_t) mutable std::array<std::byte, sizeof(value_t)> _storage {};
+        bool _has_value = false;
+
+        [[nodiscard]] constexpr value_t* value() const noexcept
+        {
+            return reinterpret_cast<value_t*>(std::addressof(_storage[0]));
+        }
+
+        constexpr void copy(const proxy_storage_inline& other) SPORE_PROXY_THROW_SPEC
+        {
+            if (other._has_value)
+            {
+                std::construct_at(value(), *other.value());
+                _has_value = true;
+            }
+        }
+
+        // trivially relocatable values are copied with the whole buffer and the other storage no longer owns them,
+        // otherwise the value is moved and the other storage keeps the moved-from value
+        constexpr void relocate(proxy_storage_inline& other) noexcept(is_nothrow_relocatable)
+        {
+            if (other._has_value)
+            {
+                if constexpr (proxy_trivially_relocatable_v<value_t>)
+                {
+                    _storage = other._storage;
+                    other._has_value = false;
+                }
+                else
+                {
+                    std::construct_at(value(), std::move(*other.value()));
+                }
+
+                _has_value = true;
+            }
+        }
+    };
+
+    template <typename... values_t>
+    struct proxy_storage_variant;
+
+    namespace proxies::detail
+    {
+        // whether every value a storage can hold is one of values_t, which is only known for storages of closed sets
+        template <typename storage_t, typename... values_t>
+        struct storage_holds_only : std::false_type
+        {
+        };
+
+        template <typename value_t, typename... values_t>
+        struct storage_holds_only<proxy_storage_inline<value_t>, values_t...> : std::bool_constant<(... or std::is_same_v<value_t, values_t>)>
+        {
+        };
+
+        template <typename... other_values_t, typename... values_t>
+        struct storage_holds_only<proxy_storage_variant<other_values_t...>, values_t...>
+            : std::bool_constant<(... and storage_holds_only<proxy_storage_inline<other_values_t>, values_t...>::value)>
+        {
+        };
+    }
+
+    // closed set of values stored inline, the index of the value in the set selects its lifecycle operations instead of
+    // the type info's function pointers, so that copies, moves and destruction can be inlined
+    template <typename... values_t>
+    struct proxy_storage_variant
+    {
+        static_assert(sizeof...(values_t) > 0);
+        static_assert(sizeof...(values_t) < std::numeric_limits<std::uint16_t>::max());
+
+        template <typename value_t>
+        static consteval bool is_constructible()
+        {
+            return (... or std::is_same_v<value_t, values_t>);
+        }
+
+        proxy_storage_variant() = default;
+
+        template <typename value_t, typename... args_t>
+        constexpr explicit proxy_storage_variant(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
+            requires(is_constructible<value_t>())
+        {
+            std::construct_at(value<value_t>(), std::forward<args_t>(args)...);
+            _index = index_of<value_t>();
+        }
+
+        // only storages whose values are all in the set convert, type-erased storages could hold any value
+        template <typename storage_t>
+        constexpr explicit proxy_storage_variant(storage_t&& storage) SPORE_PROXY_THROW_SPEC
+            requires(not std::is_same_v<std::decay_t<storage_t>, proxy_storage_variant> and proxies::detail::storage_holds_only<std::decay_t<storage_t>, values_t...>::value)
+        {
+            if (const proxy_type_info* type_info = storage.type_info())
+            {
+                const index_type index = index_of(*type_info);
+
+                visit(index, [&]<typename value_t>(std::type_identity<value_t>) {
+                    auto* other_value = std::launder(static_cast<value_t*>(storage.ptr()));
+
+                    if constexpr (std::is_rvalue_reference_v<storage_t&&> and std::is_move_constructible_v<std::decay_t<storage_t>> and std::is_move_constructible_v<value_t>)
+                    {
+                        std::construct_at(value<value_t>(), std::move(*other_value));
+                    }
+                    else if constexpr (std::is_copy_constructible_v<value_t>)
+                    {
+                        std::construct_at(value<value_t>(), *other_value);
+                    }
+                    else
+                    {
+                        SPORE_PROXY_THROW("not copyable");
+                    }
+                });
+
+                _index = index;
+            }
+        }
+
+        constexpr proxy_storage_variant(const proxy_storage_variant& other) SPORE_PROXY_THROW_SPEC
+            requires(... and std::is_copy_constructible_v<values_t>)
+        {
+            copy(other);
+        }
+
+        constexpr proxy_storage_variant(proxy_storage_variant&& other) noexcept(is_nothrow_relocatable)
+            requires(... and (std::is_move_constructible_v<values_t> or proxy_trivially_relocatable_v<values_t>))
+        {
+            relocate(other);
+        }
+
+        constexpr ~proxy_storage_variant() noexcept
+        {
+            reset();
+        }
+
+        constexpr proxy_storage_variant& operator=(const proxy_storage_variant& other) SPORE_PROXY_THROW_SPEC
+            requires(... and std::is_copy_constructible_v<values_t>)
+        {
+            if (this != std::addressof(other))
+            {
+                reset();
+                copy(other);
+            }
+
+            return *this;
+        }
+
+        constexpr proxy_storage_variant& operator=(proxy_storage_variant&& other) noexcept(is_nothrow_relocatable)
+            requires(... and (std::is_move_constructible_v<values_t> or proxy_trivially_relocatable_v<values_t>))
+        {
+            if (this != std::addressof(other))
+            {
+                reset();
+                relocate(other);
+            }
+
+            return *this;
+        }
+
+        constexpr void reset() noexcept
+        {
+            if (_index != invalid_index)
+            {
+                if constexpr (not (... and std::is_trivially_destructible_v<values_t>))
+                {
+                    visit(_index, [&]<typename value_t>(std::type_identity<value_t>) {
+                        std::destroy_at(std::launder(value<value_t>()));
+                    });
+                }
+
+                _index = invalid_index;
+            }
+        }
+
+        [[nodiscard]] const proxy_type_info* type_info() const noexcept
+        {
+            static const std::array<const proxy_type_info*, sizeof...(values_t)> type_infos {
+                std::addressof(proxies::detail::type_info<values_t>())...,
+            };
+
+            return _index != invalid_index ? type_infos[_index] : nullptr;
+        }
+
+        [[nodiscard]] constexpr void* ptr() const noexcept
+        {
+            return _index != invalid_index ? std::addressof(_buffer[0]) : nullptr;
+        }
+
+        // the index of the value in the set, or an invalid index if the storage is empty
+        [[nodiscard]] constexpr std::size_t index() const noexcept
+        {
+            return _index;
+        }
+
+        [[nodiscard]] static bool is_constructible(const proxy_type_info& type_info)
+        {
+            return (... or (std::addressof(type_info) == std::addressof(proxies::detail::type_info<values_t>())));
+        }
+
+      private:
+        using index_type = std::conditional_t<(sizeof...(values_t) < std::numeric_limits<std::uint8_t>::max()), std::uint8_t, std::uint16_t>;
+
+        static constexpr index_type invalid_index = std::numeric_limits<index_type>::max();
+
+        static constexpr bool is_nothrow_relocatable =
+            (... and (proxy_trivially_relocatable_v<values_t> or std::is_nothrow_move_constructible_v<values_t>));
+
+        // no initializer, the bytes are only read once a value has been constructed in them
+        alignas(values_t...) mutable std::array<std::byte, std::max({sizeof(values_t)...})> _buffer;
+        index_type _index = invalid_index;
+
+        template <typename value_t>
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE constexpr value_t* value() const noexcept
+        {
+            return reinterpret_cast<value_t*>(std::addressof(_buffer[0]));
+        }
+
+        template <typename value_t>
+        [[nodiscard]] static consteval index_type index_of() noexcept
+        {
+            index_type index = 0;
+            std::ignore = (... or (std::is_same_v<value_t, values_t> or (++index, false)));
+            return index;
+        }
+
+        [[nodiscard]] static index_type index_of(const proxy_type_info& type_info) noexcept
+        {
+            index_type index = 0;
+            std::ignore = (... or (std::addressof(type_info) == std::addressof(proxies::detail::type_info<values_t>()) or (++index, false)));
+            return index;
+        }
+
+        // calls the function with the type of the value at the index, the comparisons against consecutive constants are
+        // lowered to a switch by the compiler
+        template <typename func_t>
+        SPORE_PROXY_FORCE_INLINE static constexpr void visit(const index_type index, func_t&& func)
+        {
+            [&]<std::size_t... indices_v>(std::index_sequence<indices_v...>) {
+                std::ignore = (... or (index == indices_v and (func(std::type_identity<values_t> {}), true)));
+            }(std::index_sequence_for<values_t...> {});
+        }
+
+        constexpr void copy(const proxy_storage_variant& other) SPORE_PROXY_THROW_SPEC
+        {
+            SPORE_PROXY_ASSERT(_index == invalid_index);
+
+            if (other._index != invalid_index)
+            {
+                if constexpr ((... and std::is_trivially_copy_constructible_v<values_t>))
+                {
+                    _buffer = other._buffer;
+                }
+                else
+                {
+                    visit(other._index, [&]<typename value_t>(std::type_identity<value_t>) {
+                        std::construct_at(value<value_t>(), *std::launder(other.template value<value_t>()));
+                    });
+                }
+
+                _index = other._index;
+            }
         }
 
-        constexpr ~proxy_storage_sbo() noexcept
+        // moves the value and ends its lifetime in the other storage, like the sbo storage
+        constexpr void relocate(proxy_storage_variant& other) noexcept(is_nothrow_relocatable)
         {
-            reset();
+            SPORE_PROXY_ASSERT(_index == invalid_index);
+
+            if (other._index != invalid_index)
+            {
+                if constexpr ((... and proxy_trivially_relocatable_v<values_t>))
+                {
+                    _buffer = other._buffer;
+                }
+                else
+                {
+                    visit(other._index, [&]<typename value_t>(std::type_identity<value_t>) {
+                        if constexpr (proxy_trivially_relocatable_v<value_t>)
+                        {
+                            std::memcpy(std::addressof(_buffer[0]), std::addressof(other._buffer[0]), sizeof(value_t));
+                        }
+                        else
+                        {
+                            auto* other_value = std::launder(other.template value<value_t>());
+                            std::construct_at(value<value_t>(), std::move(*other_value));
+                            std::destroy_at(other_value);
+                        }
+                    });
+                }
+
+                _index = std::exchange(other._index, invalid_index);
+            }
         }
+    };
 
-        constexpr proxy_storage_sbo& operator=(const proxy_storage_sbo& other) SPORE_PROXY_THROW_SPEC
+    template <std::size_t size_v, std::size_t align_v = alignof(void*)>
+    struct proxy_storage_sbo
+    {
+        static_assert(size_v > 0);
+        static_assert(align_v > 0);
+
+        template <typename value_t>
+        static consteval bool is_constructible()
         {
-            reset();
+            return sizeof(value_t) <= size_v and align_v % alignof(value_t) == 0;
+        }
 
-            _type_info = other._type_info;
+        proxy_storage_sbo() = default;
 
-            if (_type_info != nullptr)
+        template <typename value_t, typename... args_t>
+        constexpr explicit proxy_storage_sbo(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
+            requires(is_constructible<value_t>())
+        {
+            _type_info = std::addressof(proxies::detail::type_info<value_t>());
+
+            std::construct_at(static_cast<value_t*>(ptr()), std::forward<args_t>(args)...);
+        }
+
+        template <typename storage_t>
+        constexpr explicit proxy_storage_sbo(storage_t&& storage) noexcept
+            requires(any_proxy_storage<std::decay_t<storage_t>>)
+        {
+            if (const proxy_type_info* type_info = storage.type_info())
             {
-                _type_info->copy(ptr(), other.ptr());
+                SPORE_PROXY_ASSERT(proxy_storage_sbo::is_constructible(*type_info));
+
+                _type_info = type_info;
+
+                if constexpr (std::is_rvalue_reference_v<storage_t&&> and std::is_move_constructible_v<std::decay_t<storage_t>>)
+                {
+                    _type_info->move(ptr(), storage.ptr());
+                }
+                else
+                {
+                    static_assert(std::is_copy_constructible_v<std::decay_t<storage_t>>);
+
+                    proxies::detail::copy(*_type_info, ptr(), storage.ptr());
+                }
             }
+        }
 
-            return *this;
+        constexpr proxy_storage_sbo(const proxy_storage_sbo& other) SPORE_PROXY_THROW_SPEC
+        {
+            copy(other);
         }
 
-        constexpr proxy_storage_sbo& operator=(proxy_storage_sbo&& other) SPORE_PROXY_THROW_SPEC
+        constexpr proxy_storage_sbo(proxy_storage_sbo&& other) noexcept
         {
-            reset();
+            relocate(other);
+        }
 
-            _type_info = other._type_info;
+        constexpr ~proxy_storage_sbo() noexcept
+        {
+            reset();
+        }
 
-            if (_type_info != nullptr)
+        constexpr proxy_storage_sbo& operator=(const proxy_storage_sbo& other) SPORE_PROXY_THROW_SPEC
+        {
+            if (this != std::addressof(other))
             {
-                _type_info->move(ptr(), other.ptr());
+                reset();
+                copy(other);
             }
 
             return *this;
         }
 
+        constexpr proxy_storage_sbo& operator=(proxy_storage_sbo&& other) SPORE_PROXY_THROW_SPEC
+        {
+            reset();
+            relocate(other);
+
+            return *this;
+        }
+
         void reset() noexcept
         {
             if (_type_info != nullptr)
             {
-                _type_info->destroy(ptr());
+                proxies::detail::destroy(*_type_info, ptr());
                 _type_info = nullptr;
             }
         }
@@ -570,8 +1861,84 @@ namespace spore
       private:
         const proxy_type_info* _type_info = nullptr;
         alignas(align_v) mutable std::array<std::byte, size_v> _storage {};
+
+        constexpr void copy(const proxy_storage_sbo& other) SPORE_PROXY_THROW_SPEC
+        {
+            SPORE_PROXY_ASSERT(_type_info == nullptr);
+
+            if (other._type_info != nullptr)
+            {
+                if (other._type_info->trivially_copyable)
+                {
+                    SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::copy, other._type_info, other._type_info->size);
+                    _storage = other._storage;
+                }
+                else
+                {
+                    other._type_info->copy(std::addressof(_storage[0]), other.ptr());
+                }
+
+                _type_info = other._type_info;
+            }
+        }
+
+        // moves the value and ends its lifetime in the other storage, trivially relocatable values are copied with the
+        // whole buffer, so that container growth and swaps don't go through the type info
+        constexpr void relocate(proxy_storage_sbo& other) SPORE_PROXY_THROW_SPEC
+        {
+            SPORE_PROXY_ASSERT(_type_info == nullptr);
+
+            if (other._type_info != nullptr)
+            {
+                if (other._type_info->trivially_relocatable)
+                {
+                    SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::move, other._type_info, other._type_info->size);
+                    _storage = other._storage;
+                }
+                else
+                {
+                    other._type_info->relocate(std::addressof(_storage[0]), other.ptr());
+                }
+
+                _type_info = std::exchange(other._type_info, nullptr);
+            }
+        }
     };
 
+    // list of values, e.g. the implementations of a facade that size the inline buffer of value_proxy_auto
+    template <typename... values_t>
+    struct proxy_value_types
+    {
+    };
+
+    namespace proxies::detail
+    {
+        template <typename... value_types_t>
+        struct concat_value_types;
+
+        template <typename... values_t>
+        struct concat_value_types<proxy_value_types<values_t...>>
+        {
+            using type = proxy_value_types<values_t...>;
+        };
+
+        template <typename... values_t, typename... other_values_t, typename... value_types_t>
+        struct concat_value_types<proxy_value_types<values_t...>, proxy_value_types<other_values_t...>, value_types_t...>
+            : concat_value_types<proxy_value_types<values_t..., other_values_t...>, value_types_t...>
+        {
+        };
+
+        template <typename value_types_t>
+        struct sbo_for_value_types;
+
+        // the union of the chain storage holds a pointer to heap values, so the buffer never needs to be smaller
+        template <typename... values_t>
+        struct sbo_for_value_types<proxy_value_types<values_t...>>
+        {
+            using type = proxy_storage_sbo<std::max({sizeof(void*), sizeof(values_t)...}), std::max({alignof(void*), alignof(values_t)...})>;
+        };
+    }
+
     template <any_proxy_storage... storages_t>
     struct proxy_storage_chain
     {
@@ -585,7 +1952,7 @@ namespace spore
 
         template <typename storage_t>
         constexpr explicit proxy_storage_chain(storage_t&& storage) noexcept
-            requires(any_proxy_storage<std::decay_t<storage_t>>)
+            requires(any_proxy_storage<std::decay_t<storage_t>> and not std::is_same_v<std::decay_t<storage_t>, proxy_storage_chain>)
         {
             if (const proxy_type_info* type_info = storage.type_info())
             {
@@ -612,7 +1979,7 @@ namespace spore
 
         [[nodiscard]] static constexpr bool is_constructible(const proxy_type_info& type_info)
         {
-            return (... or storages_t::is_constructible_from(type_info));
+            return (... or storages_t::is_constructible(type_info));
         }
 
       private:
@@ -651,4 +2018,229 @@ namespace spore
             return false;
         }
     };
+
+    // flattened chain of sbo and value storages, the value is either stored in the inline buffer or on the heap, which is
+    // known from its type info alone, so that a single type info pointer is needed instead of a variant
+    template <std::size_t size_v, std::size_t align_v>
+    struct proxy_storage_chain<proxy_storage_sbo<size_v, align_v>, proxy_storage_value>
+    {
+        template <typename value_t>
+        [[nodiscard]] static consteval bool is_inline()
+        {
+            constexpr bool is_nothrow_relocatable = std::is_nothrow_move_constructible_v<value_t> or proxy_trivially_relocatable_v<value_t>;
+            return proxy_storage_sbo<size_v, align_v>::template is_constructible<value_t>() and is_nothrow_relocatable;
+        }
+
+        proxy_storage_chain() = default;
+
+        template <typename value_t, typename... args_t>
+        constexpr explicit proxy_storage_chain(std::in_place_type_t<value_t>, args_t&&... args) SPORE_PROXY_THROW_SPEC
+        {
+            if constexpr (is_inline<value_t>())
+            {
+                std::construct_at(reinterpret_cast<value_t*>(std::addressof(_buffer[0])), std::forward<args_t>(args)...);
+            }
+            else
+            {
+                _heap = new value_t {std::forward<args_t>(args)...};
+
+                SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::spill, std::addressof(proxies::detail::type_info<value_t>()), sizeof(value_t));
+                SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::allocate, std::addressof(proxies::detail::type_info<value_t>()), sizeof(value_t));
+            }
+
+            _type_info = std::addressof(proxies::detail::type_info<value_t>());
+        }
+
+        template <typename storage_t>
+        constexpr explicit proxy_storage_chain(storage_t&& storage) noexcept
+            requires(any_proxy_storage<std::decay_t<storage_t>> and not std::is_same_v<std::decay_t<storage_t>, proxy_storage_chain>)
+        {
+            if (const proxy_type_info* type_info = storage.type_info())
+            {
+                void* ptr = allocate(*type_info);
+
+                if constexpr (std::is_rvalue_reference_v<storage_t&&> and std::is_move_constructible_v<std::decay_t<storage_t>>)
+                {
+                    type_info->move(ptr, storage.ptr());
+                }
+                else
+                {
+                    static_assert(std::is_copy_constructible_v<std::decay_t<storage_t>>);
+
+                    proxies::detail::copy(*type_info, ptr, storage.ptr());
+                }
+
+                _type_info = type_info;
+            }
+        }
+
+        constexpr proxy_storage_chain(const proxy_storage_chain& other) SPORE_PROXY_THROW_SPEC
+        {
+            copy(other);
+        }
+
+        constexpr proxy_storage_chain(proxy_storage_chain&& other) noexcept
+        {
+            relocate(other);
+        }
+
+        constexpr ~proxy_storage_chain() noexcept
+        {
+            reset();
+        }
+
+        constexpr proxy_storage_chain& operator=(const proxy_storage_chain& other) SPORE_PROXY_THROW_SPEC
+        {
+            if (this != std::addressof(other))
+            {
+                reset();
+                copy(other);
+            }
+
+            return *this;
+        }
+
+        constexpr proxy_storage_chain& operator=(proxy_storage_chain&& other) noexcept
+        {
+            if (this != std::addressof(other))
+            {
+                reset();
+                relocate(other);
+            }
+
+            return *this;
+        }
+
+        constexpr void reset() noexcept
+        {
+            if (_type_info != nullptr)
+            {
+                if (is_inline(*_type_info))
+                {
+                    proxies::detail::destroy(*_type_info, std::addressof(_buffer[0]));
+                }
+                else
+                {
+                    proxies::detail::destroy(*_type_info, _heap);
+                    proxies::detail::deallocate(*_type_info, _heap);
+                }
+
+                _type_info = nullptr;
+            }
+        }
+
+        [[nodiscard]] constexpr const proxy_type_info* type_info() const noexcept
+        {
+            return _type_info;
+        }
+
+        [[nodiscard]] constexpr void* ptr() const noexcept
+        {
+            if (_type_info == nullptr)
+            {
+                return nullptr;
+            }
+
+            return is_inline(*_type_info) ? std::addressof(_buffer[0]) : _heap;
+        }
+
+        [[nodiscard]] static constexpr bool is_constructible(const proxy_type_info&)
+        {
+            return true;
+        }
+
+      private:
+        const proxy_type_info* _type_info = nullptr;
+
+        union
+        {
+            void* _heap = nullptr;
+            alignas(align_v) mutable std::array<std::byte, size_v> _buffer;
+        };
+
+        // values that could throw while being relocated are stored on the heap, so that moves never throw
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE static constexpr bool is_inline(const proxy_type_info& type_info) noexcept
+        {
+            return proxy_storage_sbo<size_v, align_v>::is_constructible(type_info) and (type_info.nothrow_move or type_info.trivially_relocatable);
+        }
+
+        [[nodiscard]] constexpr void* allocate(const proxy_type_info& type_info) SPORE_PROXY_THROW_SPEC
+        {
+            if (is_inline(type_info))
+            {
+                return std::addressof(_buffer[0]);
+            }
+
+            SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::spill, std::addressof(type_info), type_info.size);
+
+            _heap = proxies::detail::allocate(type_info);
+            return _heap;
+        }
+
+        constexpr void copy(const proxy_storage_chain& other) SPORE_PROXY_THROW_SPEC
+        {
+            SPORE_PROXY_ASSERT(_type_info == nullptr);
+
+            if (other._type_info != nullptr)
+            {
+                if (is_inline(*other._type_info) and other._type_info->trivially_copyable)
+                {
+                    SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::copy, other._type_info, other._type_info->size);
+                    _buffer = other._buffer;
+                }
+                else if (is_inline(*other._type_info))
+                {
+                    proxies::detail::copy(*other._type_info, std::addressof(_buffer[0]), other.ptr());
+                }
+                else
+                {
+                    // the storage stays empty when the copy throws, so the block is freed here rather than by reset
+                    struct allocation_guard
+                    {
+                        const proxy_type_info& type_info;
+                        void* ptr;
+
+                        constexpr ~allocation_guard() noexcept
+                        {
+                            if (ptr != nullptr)
+                            {
+                                proxies::detail::deallocate(type_info, ptr);
+                            }
+                        }
+                    };
+
+                    allocation_guard guard {*other._type_info, allocate(*other._type_info)};
+                    proxies::detail::copy(*other._type_info, guard.ptr, other.ptr());
+                    guard.ptr = nullptr;
+                }
+
+                _type_info = other._type_info;
+            }
+        }
+
+        // heap values are stolen and inline values are relocated, the other storage is left empty in both cases
+        constexpr void relocate(proxy_storage_chain& other) noexcept
+        {
+            SPORE_PROXY_ASSERT(_type_info == nullptr);
+
+            if (other._type_info != nullptr)
+            {
+                if (not is_inline(*other._type_info))
+                {
+                    _heap = other._heap;
+                }
+                else if (other._type_info->trivially_relocatable)
+                {
+                    SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::move, other._type_info, other._type_info->size);
+                    _buffer = other._buffer;
+                }
+                else
+                {
+                    other._type_info->relocate(std::addressof(_buffer[0]), std::addressof(other._buffer[0]));
+                }
+
+                _type_info = std::exchange(other._type_info, nullptr);
+            }
+        }
+    };
 }
\ No newline at end of file
@@ -1,22 +1,43 @@
 #pragma once
 
+#include "spore/proxy/proxy_instrument.hpp"
 #include "spore/proxy/proxy_macros.hpp"
 
 #include <cstddef>
 #include <cstring>
 #include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
 
 namespace spore
 {
+    // values that can be moved to a new address with memcpy, leaving the old address uninitialized, can opt-in by
+    // specializing this trait
+    template <typename value_t>
+    struct proxy_trivially_relocatable
+        : std::bool_constant<std::is_trivially_move_constructible_v<value_t> and std::is_trivially_destructible_v<value_t>>
+    {
+    };
+
+    template <typename value_t>
+    inline constexpr bool proxy_trivially_relocatable_v = proxy_trivially_relocatable<value_t>::value;
+
     struct proxy_type_info
     {
         std::size_t size;
         std::size_t alignment;
-        void* (*allocate)();
-        void (*deallocate)(void*) noexcept;
         void (*destroy)(void*) noexcept;
         void (*move)(void*, void*);
         void (*copy)(void*, const void*);
+        void (*relocate)(void*, void*);
+        bool trivially_destructible : 1;
+        bool trivially_copyable : 1;
+        bool trivially_relocatable : 1;
+        bool nothrow_move : 1;
+#ifdef SPORE_PROXY_INSTRUMENT
+        std::string_view name;
+#endif
     };
 
     namespace proxies::detail
@@ -28,14 +49,6 @@ namespace spore
             static const proxy_type_info type_info {
                 .size = sizeof(value_t),
                 .alignment = alignof(value_t),
-                .allocate = []() SPORE_PROXY_THROW_SPEC {
-                    auto* value = std::allocator<value_t>().allocate(1);
-                    return static_cast<void*>(value);
-                },
-                .deallocate = [](void* ptr) noexcept {
-                    auto* value = std::launder(static_cast<value_t*>(ptr));
-                    std::allocator<value_t>().deallocate(value, 1);
-                },
                 .destroy = [](void* ptr) noexcept {
                     if constexpr (std::is_destructible_v<value_t>)
                     {
@@ -44,6 +57,8 @@ namespace spore
                     }
                 },
                 .move = [](void* ptr, void* other_ptr) SPORE_PROXY_THROW_SPEC {
+                    SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::move, std::addressof(type_info), sizeof(value_t));
+
                     if constexpr (std::is_trivially_move_constructible_v<value_t>)
                     {
                         std::memcpy(ptr, other_ptr, sizeof(value_t));
@@ -60,6 +75,8 @@ namespace spore
                     }
                 },
                 .copy = [](void* ptr, const void* other_ptr) SPORE_PROXY_THROW_SPEC {
+                    SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::copy, std::addressof(type_info), sizeof(value_t));
+
                     if constexpr (std::is_trivially_copy_constructible_v<value_t>)
                     {
                         std::memcpy(ptr, other_ptr, sizeof(value_t));
@@ -75,10 +92,86 @@ namespace spore
                         SPORE_PROXY_THROW("not copyable");
                     }
                 },
+                .relocate = [](void* ptr, void* other_ptr) SPORE_PROXY_THROW_SPEC {
+                    SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::move, std::addressof(type_info), sizeof(value_t));
+
+                    if constexpr (proxy_trivially_relocatable_v<value_t>)
+                    {
+                        std::memcpy(ptr, other_ptr, sizeof(value_t));
+                    }
+                    else if constexpr (std::is_move_constructible_v<value_t> and std::is_destructible_v<value_t>)
+                    {
+                        auto* value = std::launder(static_cast<value_t*>(ptr));
+                        auto* other_value = std::launder(static_cast<value_t*>(other_ptr));
+                        std::construct_at(value, std::move(*other_value));
+                        std::destroy_at(other_value);
+                    }
+                    else
+                    {
+                        SPORE_PROXY_THROW("not relocatable");
+                    }
+                },
+                .trivially_destructible = std::is_trivially_destructible_v<value_t>,
+                .trivially_copyable = std::is_trivially_copy_constructible_v<value_t>,
+                .trivially_relocatable = proxy_trivially_relocatable_v<value_t>,
+                .nothrow_move = std::is_nothrow_move_constructible_v<value_t>,
+#ifdef SPORE_PROXY_INSTRUMENT
+                .name = type_name<value_t>(),
+#endif
             };
             // clang-format on
 
             return type_info;
         }
+
+        // lifecycle operations that skip the type info's function pointers when its trait bits allow it, the
+        // allocation matches what a new expression of the value type would do
+
+        [[nodiscard]] SPORE_PROXY_FORCE_INLINE void* allocate(const proxy_type_info& type_info) SPORE_PROXY_THROW_SPEC
+        {
+            SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::allocate, std::addressof(type_info), type_info.size);
+
+            if (type_info.alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                return ::operator new(type_info.size, std::align_val_t {type_info.alignment});
+            }
+
+            return ::operator new(type_info.size);
+        }
+
+        SPORE_PROXY_FORCE_INLINE void deallocate(const proxy_type_info& type_info, void* ptr) noexcept
+        {
+            SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::deallocate, std::addressof(type_info), type_info.size);
+
+            if (type_info.alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::operator delete(ptr, std::align_val_t {type_info.alignment});
+            }
+            else
+            {
+                ::operator delete(ptr);
+            }
+        }
+
+        SPORE_PROXY_FORCE_INLINE void destroy(const proxy_type_info& type_info, void* ptr) noexcept
+        {
+            if (not type_info.trivially_destructible)
+            {
+                type_info.destroy(ptr);
+            }
+        }
+
+        SPORE_PROXY_FORCE_INLINE void copy(const proxy_type_info& type_info, void* ptr, const void* other_ptr) SPORE_PROXY_THROW_SPEC
+        {
+            if (type_info.trivially_copyable)
+            {
+                SPORE_PROXY_INSTRUMENT_EVENT(proxy_event::copy, std::addressof(type_info), type_info.size);
+                std::memcpy(ptr, other_ptr, type_info.size);
+            }
+            else
+            {
+                type_info.copy(ptr, other_ptr);
+            }
+        }
     }
 }
\ No newline at end of file
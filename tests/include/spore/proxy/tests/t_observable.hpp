@@ -54,6 +54,43 @@ namespace spore::proxies::tests::observable
         }
     };
 
+    struct intrusive_impl : impl
+    {
+        std::uint32_t count = 0;
+
+        using impl::impl;
+
+        friend void proxy_intrusive_add_ref(intrusive_impl& value) noexcept
+        {
+            ++value.count;
+        }
+
+        friend void proxy_intrusive_release(intrusive_impl& value) noexcept
+        {
+            if (--value.count == 0)
+            {
+                delete std::addressof(value);
+            }
+        }
+    };
+
+    struct relocatable_impl : impl
+    {
+        using impl::impl;
+    };
+
+    struct deleter
+    {
+        static inline std::size_t count = 0;
+
+        template <typename value_t>
+        void operator()(value_t* value) const noexcept
+        {
+            ++count;
+            delete value;
+        }
+    };
+
     struct base : proxy_facade<base>
     {
     };
@@ -67,4 +104,12 @@ namespace spore::proxies::tests::observable
             return proxies::dispatch<value_t&>(f, *this);
         }
     };
+}
+
+namespace spore
+{
+    template <>
+    struct proxy_trivially_relocatable<proxies::tests::observable::relocatable_impl> : std::true_type
+    {
+    };
 }
\ No newline at end of file
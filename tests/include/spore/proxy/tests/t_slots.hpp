@@ -0,0 +1,108 @@
+#pragma once
+
+#include "spore/proxy/proxy.hpp"
+
+#include <utility>
+
+namespace spore::proxies::tests::slots
+{
+    template <typename dispatch_t>
+    struct facade : proxy_facade<facade<dispatch_t>>
+    {
+        using dispatch_type [[maybe_unused]] = dispatch_t;
+
+        static constexpr auto get_func = [](const auto& self, const int offset) { return self.get(offset); };
+        static constexpr auto add_func = [](auto& self, const int amount) { self.add(amount); };
+        static constexpr auto take_func = []<typename self_t>(self_t&& self) { return std::forward<self_t>(self).take(); };
+
+        using inline_slots = proxy_inline_slots<
+            proxy_inline_slot<decltype(get_func), int(int) const>,
+            proxy_inline_slot<decltype(add_func), void(int)>,
+            proxy_inline_slot<decltype(take_func), int() &&>>;
+
+        int get(const int offset) const
+        {
+            return proxies::dispatch<int>(get_func, *this, offset);
+        }
+
+        void add(const int amount)
+        {
+            proxies::dispatch(add_func, *this, amount);
+        }
+
+        int take() &&
+        {
+            return proxies::dispatch<int>(take_func, std::move(*this));
+        }
+
+        // not a slot, dispatched through the table
+        int twice() const
+        {
+            constexpr auto func = [](const auto& self) { return self.get(0) * 2; };
+            return proxies::dispatch<int>(func, *this);
+        }
+    };
+
+    template <typename dispatch_t>
+    struct extended_facade : proxy_facade<extended_facade<dispatch_t>, facade<dispatch_t>>
+    {
+        using dispatch_type [[maybe_unused]] = dispatch_t;
+
+        static constexpr auto negate_func = [](const auto& self) { return -self.get(0); };
+
+        using inline_slots = typename facade<dispatch_t>::inline_slots::template append<proxy_inline_slot<decltype(negate_func), int() const>>;
+
+        int negate() const
+        {
+            return proxies::dispatch<int>(negate_func, *this);
+        }
+    };
+
+    // not valid, only checked by proxies::detail::inline_slots_follow_bases
+
+    template <typename dispatch_t>
+    struct reordered_facade : proxy_facade<reordered_facade<dispatch_t>, facade<dispatch_t>>
+    {
+        using dispatch_type [[maybe_unused]] = dispatch_t;
+
+        static constexpr auto negate_func = [](const auto& self) { return -self.get(0); };
+
+        using inline_slots = proxy_inline_slots<proxy_inline_slot<decltype(negate_func), int() const>, proxy_inline_slot<decltype(facade<dispatch_t>::get_func), int(int) const>>;
+    };
+
+    template <typename dispatch_t>
+    struct other_facade : proxy_facade<other_facade<dispatch_t>>
+    {
+        using dispatch_type [[maybe_unused]] = dispatch_t;
+
+        static constexpr auto negate_func = [](const auto& self) { return -self.get(0); };
+
+        using inline_slots = proxy_inline_slots<proxy_inline_slot<decltype(negate_func), int() const>>;
+    };
+
+    template <typename dispatch_t>
+    struct merged_facade : proxy_facade<merged_facade<dispatch_t>, facade<dispatch_t>, other_facade<dispatch_t>>
+    {
+        using dispatch_type [[maybe_unused]] = dispatch_t;
+    };
+
+    struct impl
+    {
+        int value = 0;
+
+        int get(const int offset) const
+        {
+            return value + offset;
+        }
+
+        void add(const int amount)
+        {
+            value += amount;
+        }
+
+        int take() &&
+        {
+            return std::exchange(value, 0);
+        }
+    };
+}
\ No newline at end of file
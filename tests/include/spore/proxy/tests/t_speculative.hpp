@@ -0,0 +1,39 @@
+#pragma once
+
+#include "spore/proxy/proxy.hpp"
+
+namespace spore::proxies::tests::speculative
+{
+    template <typename dispatch_t>
+    struct facade : proxy_facade<facade<dispatch_t>>
+    {
+        using dispatch_type = proxy_dispatch_speculative<dispatch_t>;
+
+        int id() const
+        {
+            constexpr auto func = [](const auto& self) { return self.id(); };
+            return proxies::dispatch<int>(func, *this);
+        }
+    };
+
+    struct hot_impl
+    {
+        int id() const
+        {
+            return 1;
+        }
+    };
+
+    struct cold_impl
+    {
+        int id() const
+        {
+            return 2;
+        }
+    };
+}
+
+template <typename dispatch_t>
+struct spore::proxy_dispatch_profile<spore::proxies::tests::speculative::facade<dispatch_t>> : spore::proxy_dispatch_hot<spore::proxies::tests::speculative::hot_impl>
+{
+};
\ No newline at end of file
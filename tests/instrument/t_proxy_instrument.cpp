@@ -0,0 +1,144 @@
+#include "catch2/catch_all.hpp"
+
+#include "spore/proxy/proxy.hpp"
+#include "spore/proxy/tests/t_speculative.hpp"
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+namespace spore::proxies::tests::instrument
+{
+    struct facade : proxy_facade<facade>
+    {
+    };
+
+    struct small_impl
+    {
+        int value = 0;
+    };
+
+    struct large_impl
+    {
+        std::array<std::size_t, 16> values {};
+    };
+
+    template <typename value_t>
+    proxy_instrument_counts counts_of()
+    {
+        const std::vector<proxy_instrument_entry> entries = proxies::instrument_snapshot();
+
+        const auto it = std::ranges::find_if(entries, [](const proxy_instrument_entry& entry) {
+            return entry.facade.ends_with("facade") and entry.type_info == std::addressof(proxies::detail::type_info<value_t>());
+        });
+
+        return it != entries.end() ? it->counts : proxy_instrument_counts {};
+    }
+}
+
+TEST_CASE("spore::proxy::instrument", "[spore::proxy][spore::proxy::instrument]")
+{
+    using namespace spore;
+    using namespace spore::proxies::tests::instrument;
+
+    SECTION("names")
+    {
+        REQUIRE(proxies::detail::type_info<small_impl>().name == "spore::proxies::tests::instrument::small_impl");
+        REQUIRE(proxies::detail::instrument_facade_of<facade>().name == "spore::proxies::tests::instrument::facade");
+    }
+
+    SECTION("inline value")
+    {
+        const proxy_instrument_counts before = counts_of<small_impl>();
+
+        {
+            value_proxy<facade> p1 = proxies::make_value<facade>(small_impl {});
+            value_proxy<facade> p2 = p1;
+            value_proxy<facade> p3 = std::move(p1);
+        }
+
+        const proxy_instrument_counts after = counts_of<small_impl>();
+
+        REQUIRE(after.allocations == before.allocations);
+        REQUIRE(after.spills == before.spills);
+        REQUIRE(after.copies == before.copies + 1);
+        REQUIRE(after.moves >= before.moves + 1);
+    }
+
+    SECTION("spilled value")
+    {
+        const proxy_instrument_counts before = counts_of<large_impl>();
+
+        {
+            value_proxy<facade> p1 = proxies::make_value<facade>(large_impl {});
+            value_proxy<facade> p2 = p1;
+        }
+
+        const proxy_instrument_counts after = counts_of<large_impl>();
+
+        REQUIRE(after.spills == before.spills + 2);
+        REQUIRE(after.allocations == before.allocations + 2);
+        REQUIRE(after.allocated_bytes == before.allocated_bytes + 2 * sizeof(large_impl));
+        REQUIRE(after.deallocations == before.deallocations + 2);
+        REQUIRE(after.deallocated_bytes == before.deallocated_bytes + 2 * sizeof(large_impl));
+        REQUIRE(after.copies == before.copies + 1);
+    }
+
+    SECTION("shared value")
+    {
+        const proxy_instrument_counts before = counts_of<large_impl>();
+
+        {
+            shared_proxy<facade> p1 = proxies::make_shared<facade>(large_impl {});
+            shared_proxy<facade> p2 = p1;
+        }
+
+        const proxy_instrument_counts after = counts_of<large_impl>();
+
+        REQUIRE(after.allocations == before.allocations + 1);
+        REQUIRE(after.allocated_bytes > before.allocated_bytes + sizeof(large_impl));
+        REQUIRE(after.deallocations == before.deallocations + 1);
+        REQUIRE(after.copies == before.copies);
+    }
+
+    SECTION("exited threads")
+    {
+        const proxy_instrument_counts before = counts_of<large_impl>();
+
+        std::thread thread {[] {
+            value_proxy<facade> p = proxies::make_value<facade>(large_impl {});
+        }};
+
+        thread.join();
+
+        const proxy_instrument_counts after = counts_of<large_impl>();
+
+        REQUIRE(after.allocations == before.allocations + 1);
+        REQUIRE(after.deallocations == before.deallocations + 1);
+    }
+
+    SECTION("dispatch profile")
+    {
+        using profile_facade = proxies::tests::speculative::facade<proxy_dispatch_dynamic<>>;
+
+        value_proxy<profile_facade> hot = proxies::make_value<profile_facade>(proxies::tests::speculative::hot_impl {});
+        value_proxy<profile_facade> cold = proxies::make_value<profile_facade>(proxies::tests::speculative::cold_impl {});
+
+        for (int index = 0; index < 3; ++index)
+        {
+            REQUIRE(hot.id() == 1);
+        }
+
+        REQUIRE(cold.id() == 2);
+
+        const std::vector<proxy_dispatch_entry> entries = proxies::dispatch_snapshot();
+        const std::string facade_name = std::string {proxies::detail::type_name<profile_facade>()};
+
+        const std::string header = proxies::dispatch_profile_header(entries);
+        REQUIRE(header.starts_with("#pragma once"));
+        REQUIRE(header.find("struct spore::proxy_dispatch_profile<" + facade_name + "> : spore::proxy_dispatch_hot<spore::proxies::tests::speculative::hot_impl, spore::proxies::tests::speculative::cold_impl>") != std::string::npos);
+
+        const std::string hottest = proxies::dispatch_profile_header(entries, 1);
+        REQUIRE(hottest.find("struct spore::proxy_dispatch_profile<" + facade_name + "> : spore::proxy_dispatch_hot<spore::proxies::tests::speculative::hot_impl>") != std::string::npos);
+    }
+}
\ No newline at end of file
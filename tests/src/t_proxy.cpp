@@ -6,13 +6,17 @@
 #include "spore/proxy/tests/t_conversions.hpp"
 #include "spore/proxy/tests/t_dispatch.hpp"
 #include "spore/proxy/tests/t_observable.hpp"
+#include "spore/proxy/tests/t_slots.hpp"
+#include "spore/proxy/tests/t_speculative.hpp"
 #include "spore/proxy/tests/t_templates.hpp"
 #include "spore/proxy/tests/t_thread.hpp"
 #include "spore/proxy/tests/t_translation_unit.hpp"
 
 #include <algorithm>
 #include <array>
+#include <sstream>
 #include <thread>
+#include <utility>
 
 #ifndef SPORE_PROXY_TEST_THREAD_COUNT
 #    define SPORE_PROXY_TEST_THREAD_COUNT 24
@@ -349,6 +353,411 @@ TEMPLATE_TEST_CASE("spore::proxy", "[spore::proxy]", (spore::proxy_dispatch_stat
         }
     }
 
+    SECTION("bind")
+    {
+        struct bind_facade : proxy_facade<bind_facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+        };
+
+        struct bind_impl
+        {
+            int value = 0;
+
+            int get(const int offset) const
+            {
+                return value + offset;
+            }
+
+            void add(const int amount)
+            {
+                value += amount;
+            }
+
+            int take() &&
+            {
+                return std::exchange(value, 0);
+            }
+        };
+
+        constexpr auto get = [](const auto& self, const int offset) { return self.get(offset); };
+        constexpr auto add = [](auto& self, const int amount) { self.add(amount); };
+        constexpr auto take = []<typename self_t>(self_t&& self) { return std::forward<self_t>(self).take(); };
+
+        proxy p = proxies::make_value<bind_facade>(bind_impl {});
+        const unique_proxy<bind_facade> u = proxies::make_unique<bind_facade>(bind_impl {});
+
+        const auto bound_add = proxies::bind<void(int)>(add, p);
+        const auto bound_get = proxies::bind<int(int)>(get, std::as_const(p));
+
+        for (int index = 0; index < 4; ++index)
+        {
+            bound_add(index);
+        }
+
+        REQUIRE(bound_get(1) == 7);
+        REQUIRE(proxies::bind<int(int)>(get, std::as_const(*u))(2) == 2);
+
+        proxies::bind<void(int)>(add, *u)(3);
+
+        auto bound_take = proxies::bind<int()>(take, std::move(p));
+
+        static_assert(std::is_invocable_v<decltype(bound_get), int>);
+        static_assert(not std::is_invocable_v<decltype(bound_take)&>);
+        static_assert(std::is_invocable_v<decltype(bound_take)&&>);
+
+        REQUIRE(std::move(bound_take)() == 6);
+        REQUIRE(bound_get(0) == 0);
+        REQUIRE(proxies::bind<int()>(take, std::move(*u))() == 3);
+
+        // the hooks of hooked storages run once when binding, a mutable binding detaches a shared value
+        const cow_proxy<bind_facade> shared = proxies::make_cow<bind_facade>(bind_impl {1});
+        cow_proxy<bind_facade> c = shared;
+
+        const auto bound_cow_get = proxies::bind<int(int)>(get, std::as_const(c));
+
+        REQUIRE(c.ptr() == shared.ptr());
+
+        const auto bound_cow_add = proxies::bind<void(int)>(add, c);
+
+        REQUIRE(c.ptr() != shared.ptr());
+
+        bound_cow_add(2);
+        bound_cow_add(3);
+
+        REQUIRE(bound_cow_get(0) == 1);
+        REQUIRE(proxies::bind<int(int)>(get, std::as_const(c))(0) == 6);
+        REQUIRE(proxies::bind<int(int)>(get, shared)(0) == 1);
+
+        lazy_proxy<bind_facade> l = proxies::make_lazy<bind_facade, bind_impl>(4);
+
+        REQUIRE(l.ptr() == nullptr);
+
+        const auto bound_lazy_add = proxies::bind<void(int)>(add, l);
+
+        REQUIRE(l.ptr() != nullptr);
+
+        bound_lazy_add(1);
+
+        REQUIRE(proxies::bind<int(int)>(get, std::as_const(*l))(0) == 5);
+    }
+
+    SECTION("inline slots")
+    {
+        using facade = proxies::tests::slots::facade<TestType>;
+        using extended_facade = proxies::tests::slots::extended_facade<TestType>;
+        using impl = proxies::tests::slots::impl;
+
+        static_assert(sizeof(value_proxy<facade>) == sizeof(value_proxy<proxies::tests::static_asserts::facade>) + 3 * sizeof(void (*)()));
+        static_assert(sizeof(value_proxy<extended_facade>) == sizeof(value_proxy<facade>) + sizeof(void (*)()));
+
+        value_proxy<facade> p = proxies::make_value<facade>(impl {});
+        lazy_proxy<facade> l = proxies::make_lazy<facade, impl>(2);
+        cow_proxy<facade> c = proxies::make_cow<facade>(impl {3});
+
+        p.add(1);
+        l->add(1);
+        c.add(1);
+
+        REQUIRE(p.get(1) == 2);
+        REQUIRE(l->get(1) == 4);
+        REQUIRE(c.get(1) == 5);
+        REQUIRE(p.twice() == 2);
+
+        value_proxy<facade> copy = p;
+        copy.add(2);
+
+        REQUIRE(p.get(0) == 1);
+        REQUIRE(copy.get(0) == 3);
+
+        value_proxy<facade> moved = std::move(copy);
+
+        REQUIRE(moved.get(0) == 3);
+        REQUIRE(std::move(moved).take() == 3);
+
+        value_proxy<extended_facade> e = proxies::make_value<extended_facade>(impl {4});
+
+        REQUIRE(e.get(0) == 4);
+        REQUIRE(e.negate() == -4);
+
+        const view_proxy<const facade> v = e;
+
+        REQUIRE(v->get(1) == 5);
+        REQUIRE(v->twice() == 8);
+
+        using instrumented_facade = proxies::tests::slots::facade<proxy_dispatch_instrumented<TestType>>;
+
+        value_proxy<instrumented_facade> i = proxies::make_value<instrumented_facade>(impl {5});
+        i.add(1);
+
+        REQUIRE(i.get(0) == 6);
+        REQUIRE(i.twice() == 12);
+
+        // only the method without a slot looks up the table
+        std::uint64_t calls = 0;
+
+        for (const proxy_dispatch_entry& entry : proxies::dispatch_snapshot())
+        {
+            if (entry.type_index == i.type_index() and entry.facade_id == proxies::facade_id<instrumented_facade>())
+            {
+                calls += entry.calls;
+            }
+        }
+
+        REQUIRE(calls == 1);
+
+        static_assert(proxies::detail::inline_slots_follow_bases<extended_facade>());
+        static_assert(not proxies::detail::inline_slots_follow_bases<proxies::tests::slots::reordered_facade<TestType>>());
+        static_assert(not proxies::detail::inline_slots_follow_bases<proxies::tests::slots::merged_facade<TestType>>());
+    }
+
+    SECTION("get if")
+    {
+        struct known_facade : proxy_facade<known_facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            int id() const
+            {
+                constexpr auto func = [](const auto& self) { return self.id(); };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        struct known_hot
+        {
+            int value = 1;
+
+            int id() const
+            {
+                return value;
+            }
+        };
+
+        struct known_cold
+        {
+            int id() const
+            {
+                return 2;
+            }
+        };
+
+        value_proxy<known_facade> hot = proxies::make_value<known_facade>(known_hot {});
+        const unique_proxy<known_facade> cold = proxies::make_unique<known_facade>(known_cold {});
+        lazy_proxy<known_facade> lazy = proxies::make_lazy<known_facade, known_hot>(3);
+
+        REQUIRE(proxies::holds<known_hot>(hot));
+        REQUIRE(not proxies::holds<known_cold>(hot));
+        REQUIRE(proxies::holds<known_cold>(*cold));
+        REQUIRE(proxies::holds<known_hot>(*lazy));
+
+        static_assert(std::is_same_v<decltype(proxies::get_if<known_hot>(hot)), known_hot*>);
+        static_assert(std::is_same_v<decltype(proxies::get_if<known_hot>(std::as_const(hot))), const known_hot*>);
+
+        proxies::get_if<known_hot>(hot)->value = 4;
+
+        REQUIRE(hot.id() == 4);
+        REQUIRE(proxies::get_if<known_cold>(hot) == nullptr);
+        REQUIRE(proxies::get_if<known_hot>(*cold) == nullptr);
+        REQUIRE(proxies::get_if<known_cold>(*cold) != nullptr);
+        REQUIRE(proxies::get_if<known_hot>(*lazy)->value == 3);
+
+        const auto known = [](const auto& self) {
+            return proxies::visit_known<known_hot>(
+                self,
+                [](const known_hot& value) { return value.value * 10; },
+                [](const known_facade& facade) { return facade.id(); });
+        };
+
+        REQUIRE(known(hot) == 40);
+        REQUIRE(known(*cold) == 2);
+        REQUIRE(known(*lazy) == 30);
+
+        cow_proxy<known_facade> cow = hot;
+        const value_proxy<known_facade> uncow = cow;
+
+        REQUIRE(proxies::holds<known_hot>(cow));
+        REQUIRE(not proxies::holds<known_cold>(cow));
+        REQUIRE(proxies::get_if<known_hot>(std::as_const(cow))->value == 4);
+        REQUIRE(proxies::holds<known_hot>(uncow));
+        REQUIRE(cow.id() == 4);
+        REQUIRE(uncow.id() == 4);
+        REQUIRE(known(cow) == 40);
+
+        const int moved = proxies::visit_known<known_cold, known_hot>(
+            std::move(hot),
+            [](auto&& value) { return static_cast<int>(std::is_rvalue_reference_v<decltype(value)>); },
+            [](known_facade&&) { return -1; });
+
+        REQUIRE(moved == 1);
+
+        const value_proxy<known_facade> other = std::move(hot);
+
+        REQUIRE(proxies::holds<known_hot>(other));
+        REQUIRE(not proxies::holds<known_hot>(hot));
+    }
+
+    SECTION("dispatch emplace")
+    {
+        struct emplace_shape_facade : proxy_facade<emplace_shape_facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            int sides() const
+            {
+                constexpr auto func = [](const auto& self) { return self.sides(); };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        using emplace_shape_proxy = unique_proxy<emplace_shape_facade>;
+
+        struct emplace_factory_facade : proxy_facade<emplace_factory_facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            emplace_shape_proxy make(const int sides) const
+            {
+                constexpr auto func = [](const auto& self, const auto slot, const int sides) { return self.make(slot, sides); };
+                return proxies::dispatch_emplace<emplace_shape_proxy>(func, *this, sides);
+            }
+        };
+
+        // neither copyable nor movable, so it can only be constructed in place
+        struct emplace_polygon
+        {
+            explicit emplace_polygon(const int sides)
+                : count(sides)
+            {
+            }
+
+            emplace_polygon(const emplace_polygon&) = delete;
+            emplace_polygon(emplace_polygon&&) = delete;
+
+            int sides() const
+            {
+                return count;
+            }
+
+            int count;
+        };
+
+        struct emplace_factory
+        {
+            emplace_shape_proxy make(const proxy_return_slot<emplace_shape_proxy> slot, const int sides) const
+            {
+                return slot.template emplace<emplace_polygon>(sides);
+            }
+        };
+
+        const value_proxy<emplace_factory_facade> factory = proxies::make_value<emplace_factory_facade>(emplace_factory {});
+        const emplace_shape_proxy shape = factory.make(5);
+
+        REQUIRE(shape->sides() == 5);
+        REQUIRE(proxies::holds<emplace_polygon>(*shape));
+    }
+
+    SECTION("dispatch multi")
+    {
+        struct multi_shape_facade : proxy_facade<multi_shape_facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+        };
+
+        struct multi_body_facade : proxy_facade<multi_body_facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+        };
+
+        struct multi_circle
+        {
+        };
+
+        struct multi_square
+        {
+            int hits = 0;
+        };
+
+        struct multi_collide
+        {
+            int operator()(const multi_circle&, const multi_circle&, const int scale) const
+            {
+                return 1 * scale;
+            }
+
+            int operator()(const multi_circle&, const multi_square&, const int scale) const
+            {
+                return 2 * scale;
+            }
+
+            int operator()(const multi_square&, const multi_circle&, const int scale) const
+            {
+                return 3 * scale;
+            }
+
+            int operator()(const multi_square&, const multi_square&, const int scale) const
+            {
+                return 4 * scale;
+            }
+        };
+
+        constexpr multi_collide collide;
+
+        constexpr auto hit = [](auto& self, const auto&) {
+            if constexpr (requires { self.hits; })
+            {
+                ++self.hits;
+            }
+        };
+
+        constexpr auto take = []<typename self_t>(self_t&&, const auto&) {
+            return std::is_rvalue_reference_v<self_t&&> and std::is_same_v<std::decay_t<self_t>, multi_square>;
+        };
+
+        const proxy circle = proxies::make_value<multi_shape_facade>(multi_circle {});
+        proxy square = proxies::make_value<multi_shape_facade>(multi_square {});
+        const unique_proxy<multi_body_facade> body = proxies::make_unique<multi_body_facade>(multi_square {});
+
+        for (int index = 0; index < 2; ++index)
+        {
+            REQUIRE(proxies::dispatch_multi<int>(collide, circle, circle, 10) == 10);
+            REQUIRE(proxies::dispatch_multi<int>(collide, circle, square, 10) == 20);
+            REQUIRE(proxies::dispatch_multi<int>(collide, square, circle, 10) == 30);
+            REQUIRE(proxies::dispatch_multi<int>(collide, std::as_const(square), std::as_const(*body), 10) == 40);
+        }
+
+        proxies::dispatch_multi(hit, square, circle);
+        proxies::dispatch_multi(hit, *body, square);
+        proxies::dispatch_multi(hit, *body, circle);
+
+        REQUIRE(proxies::dispatch_multi<bool>(take, std::move(square), circle));
+        REQUIRE(proxies::dispatch_multi<bool>(take, std::move(*body), circle));
+        REQUIRE(not proxies::dispatch_multi<bool>(take, std::move(circle), circle));
+
+        constexpr auto hits = [](const auto& self, const auto&) {
+            if constexpr (requires { self.hits; })
+            {
+                return self.hits;
+            }
+            else
+            {
+                return 0;
+            }
+        };
+
+        REQUIRE(proxies::dispatch_multi<int>(hits, square, circle) == 1);
+        REQUIRE(proxies::dispatch_multi<int>(hits, *body, circle) == 2);
+
+        const cow_proxy<multi_shape_facade> shared = proxies::make_cow<multi_shape_facade>(multi_square {});
+        cow_proxy<multi_shape_facade> copy = shared;
+
+        proxies::dispatch_multi(hit, copy, circle);
+
+        REQUIRE(proxies::dispatch_multi<int>(collide, copy, shared, 10) == 40);
+        REQUIRE(proxies::dispatch_multi<int>(hits, copy, circle) == 1);
+        REQUIRE(proxies::dispatch_multi<int>(hits, shared, circle) == 0);
+    }
+
     SECTION("facade inheritance")
     {
         struct facade_base1 : proxy_facade<facade_base1>
@@ -408,6 +817,629 @@ TEMPLATE_TEST_CASE("spore::proxy", "[spore::proxy]", (spore::proxy_dispatch_stat
         REQUIRE_FALSE(flag1);
     }
 
+    SECTION("copy on write")
+    {
+        struct facade : proxy_facade<facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            int get() const
+            {
+                constexpr auto func = [](const auto& self) { return self.value; };
+                return proxies::dispatch<int>(func, *this);
+            }
+
+            void set(const int value)
+            {
+                constexpr auto func = [](auto& self, const int value) { self.value = value; };
+                proxies::dispatch(func, *this, value);
+            }
+        };
+
+        struct impl
+        {
+            int value = 0;
+        };
+
+        cow_proxy<facade> p1 = proxies::make_cow<facade, impl>();
+        cow_proxy<facade> p2 = p1;
+
+        REQUIRE(p1.ptr() == p2.ptr());
+        REQUIRE(p2.get() == 0);
+        REQUIRE(p1.ptr() == p2.ptr());
+
+        p2.set(1);
+
+        REQUIRE(p1.ptr() != p2.ptr());
+        REQUIRE(p1.get() == 0);
+        REQUIRE(p2.get() == 1);
+
+        const void* ptr = p2.ptr();
+
+        p2.set(2);
+
+        REQUIRE(p2.ptr() == ptr);
+        REQUIRE(p2.get() == 2);
+    }
+
+    SECTION("variant")
+    {
+        struct facade : proxy_facade<facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            int id() const
+            {
+                constexpr auto func = [](const auto& self) { return self.id; };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        struct impl1
+        {
+            int id = 1;
+        };
+
+        struct impl2
+        {
+            int id = 2;
+            std::string name;
+        };
+
+        variant_proxy<facade, impl1, impl2> p1 = proxies::make_variant<facade, impl1, impl2>(impl1 {});
+        variant_proxy<facade, impl1, impl2> p2 = proxies::make_variant<facade, impl1, impl2>(impl2 {});
+
+        REQUIRE(p1.id() == 1);
+        REQUIRE(p2.id() == 2);
+
+        p1 = p2;
+
+        REQUIRE(p1.id() == 2);
+        REQUIRE(p1.ptr() != p2.ptr());
+
+        value_proxy<facade> p3 = p1;
+
+        REQUIRE(p3.id() == 2);
+
+        static_assert(not std::is_constructible_v<variant_proxy<facade, impl1, impl2>, value_proxy<facade>&&>);
+
+        variant_proxy<facade, impl2> p4 = proxies::make_variant<facade, impl2>(impl2 {.id = 4, .name = {}});
+        variant_proxy<facade, impl1, impl2> p5 = std::move(p4);
+
+        REQUIRE(p5.id() == 4);
+
+        variant_proxy<facade, impl1, impl2> p6 = proxies::make_variant<facade, impl1, impl2>(impl1 {});
+
+        p6 = std::move(p5);
+
+        REQUIRE(p6.id() == 4);
+    }
+
+    SECTION("external")
+    {
+        struct facade : proxy_facade<facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            int id() const
+            {
+                constexpr auto func = [](const auto& self) { return self.id; };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        struct impl
+        {
+            int id = 1;
+        };
+
+        alignas(std::max_align_t) std::array<std::byte, 64> buffer {};
+
+        external_proxy<facade> p1 = proxies::make_external<facade, impl>(buffer);
+        external_proxy<facade> p2 = std::move(p1);
+
+        REQUIRE(p2.ptr() == buffer.data());
+        REQUIRE(p2->id() == 1);
+
+        view_proxy<facade> p3 = p2;
+
+        REQUIRE(p3.ptr() == buffer.data());
+        REQUIRE(p3->id() == 1);
+    }
+
+    SECTION("auto sized value")
+    {
+        struct small_impl;
+        struct large_impl;
+
+        struct facade : proxy_facade<facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+            using value_types [[maybe_unused]] = proxy_value_types<small_impl, large_impl>;
+
+            std::size_t size() const
+            {
+                constexpr auto func = [](const auto& self) { return sizeof(self); };
+                return proxies::dispatch<std::size_t>(func, *this);
+            }
+        };
+
+        struct small_impl
+        {
+            int value = 0;
+        };
+
+        struct large_impl
+        {
+            std::array<std::size_t, 6> values {};
+        };
+
+        struct throwing_impl
+        {
+            throwing_impl() = default;
+
+            throwing_impl(throwing_impl&&) noexcept(false)
+            {
+            }
+        };
+
+        using proxy_t = value_proxy_auto<facade>;
+        using extended_proxy_t = value_proxy_auto<facade, std::array<std::size_t, 8>>;
+
+        static_assert(sizeof(proxy_t) == sizeof(proxy_base) + sizeof(void*) + sizeof(large_impl));
+        static_assert(sizeof(extended_proxy_t) == sizeof(proxy_base) + sizeof(void*) + sizeof(std::array<std::size_t, 8>));
+
+        static_assert(std::is_same_v<proxies::spilled_value_types_t<proxy_t>, proxy_value_types<>>);
+        static_assert(std::is_same_v<proxies::spilled_value_types_t<proxy_t, throwing_impl>, proxy_value_types<throwing_impl>>);
+        static_assert(std::is_same_v<proxies::spilled_value_types_t<value_proxy<facade>>, proxy_value_types<large_impl>>);
+
+        proxy_t p {std::in_place_type<large_impl>};
+
+        const auto* begin = reinterpret_cast<const std::byte*>(std::addressof(p));
+        const auto* end = begin + sizeof(p);
+
+        REQUIRE(p.ptr() >= begin);
+        REQUIRE(p.ptr() < end);
+        REQUIRE(p.size() == sizeof(large_impl));
+    }
+
+    SECTION("adoption")
+    {
+        struct facade : proxy_facade<facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            int id() const
+            {
+                constexpr auto func = [](const auto& self) { return self.id(); };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        struct base
+        {
+            virtual ~base() = default;
+            virtual int id() const = 0;
+        };
+
+        struct impl : base
+        {
+            int id() const override
+            {
+                return 1;
+            }
+        };
+
+        std::unique_ptr<base> value1 = std::make_unique<impl>();
+        std::shared_ptr<base> value2 = std::make_shared<impl>();
+
+        const void* ptr1 = value1.get();
+        const void* ptr2 = value2.get();
+
+        unique_proxy<facade> p1 = proxies::adopt_unique<facade>(std::move(value1));
+        shared_ptr_proxy<facade> p2 = proxies::adopt_shared<facade>(value2);
+
+        REQUIRE(p1.ptr() == ptr1);
+        REQUIRE(p2.ptr() == ptr2);
+        REQUIRE(p1->id() == 1);
+        REQUIRE(p2->id() == 1);
+        REQUIRE(value2.use_count() == 2);
+    }
+
+    SECTION("lazy")
+    {
+        struct facade : proxy_facade<facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            int id() const
+            {
+                constexpr auto func = [](const auto& self) { return self.id; };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        struct impl
+        {
+            int id = 0;
+        };
+
+        lazy_proxy<facade> p1 = proxies::make_lazy<facade, impl>(1);
+
+        REQUIRE(p1.ptr() == nullptr);
+        REQUIRE(p1->id() == 1);
+        REQUIRE(p1.ptr() != nullptr);
+
+        lazy_proxy<facade> p2 = std::move(p1);
+
+        REQUIRE(p2->id() == 1);
+
+        lazy_proxy_mt<facade> p3 = proxies::make_lazy_mt<facade, impl>(3);
+
+        std::array<int, 4> ids {};
+        std::vector<std::thread> threads;
+
+        for (int& id : ids)
+        {
+            threads.emplace_back([&] { id = p3->id(); });
+        }
+
+        std::ranges::for_each(threads, [](std::thread& thread) { thread.join(); });
+
+        REQUIRE(std::ranges::all_of(ids, [](const int id) { return id == 3; }));
+    }
+
+    SECTION("weak")
+    {
+        struct facade : proxy_facade<facade>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            int id() const
+            {
+                constexpr auto func = [](const auto& self) { return self.id; };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        struct impl
+        {
+            int id = 0;
+        };
+
+        shared_proxy<facade> p1 = proxies::make_shared<facade>(impl {1});
+        weak_proxy<facade> w1 = p1;
+
+        REQUIRE_FALSE(w1.expired());
+        REQUIRE(w1.lock()->id() == 1);
+
+        p1 = shared_proxy<facade> {std::in_place_type<impl>, 2};
+
+        REQUIRE(w1.expired());
+        REQUIRE(w1.lock().ptr() == nullptr);
+        REQUIRE(w1.lock().type_index() == proxy_base::invalid_type_index);
+
+        shared_proxy_mt<facade> p2 = proxies::make_shared_mt<facade>(impl {3});
+        weak_proxy_mt<facade> w2 = p2;
+
+        std::array<int, 4> ids {};
+        std::vector<std::thread> threads;
+
+        for (int& id : ids)
+        {
+            threads.emplace_back([&] { id = w2.lock()->id(); });
+        }
+
+        std::ranges::for_each(threads, [](std::thread& thread) { thread.join(); });
+
+        REQUIRE(std::ranges::all_of(ids, [](const int id) { return id == 3; }));
+    }
+
+    SECTION("instrumented dispatch")
+    {
+        struct facade : proxy_facade<facade>
+        {
+            using dispatch_type [[maybe_unused]] = proxy_dispatch_instrumented<TestType, 2>;
+
+            int id() const
+            {
+                constexpr auto func = [](const auto& self) { return self.id(); };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        struct first_impl
+        {
+            int id() const
+            {
+                return 1;
+            }
+        };
+
+        struct second_impl
+        {
+            int id() const
+            {
+                return 2;
+            }
+        };
+
+        value_proxy<facade> p1 = proxies::make_value<facade>(first_impl {});
+        value_proxy<facade> p2 = proxies::make_value<facade>(second_impl {});
+
+        for (int index = 0; index < 4; ++index)
+        {
+            REQUIRE(p1.id() == 1);
+        }
+
+        REQUIRE(p2.id() == 2);
+
+        const auto entry_of = [](const std::uint32_t type_index) {
+            const std::vector<proxy_dispatch_entry> entries = proxies::dispatch_snapshot();
+
+            const auto it = std::ranges::find_if(entries, [&](const proxy_dispatch_entry& entry) {
+                return entry.type_index == type_index and entry.facade_id == proxies::facade_id<facade>();
+            });
+
+            REQUIRE(it != entries.end());
+            return *it;
+        };
+
+        const proxy_dispatch_entry first = entry_of(p1.type_index());
+        const proxy_dispatch_entry second = entry_of(p2.type_index());
+
+        REQUIRE(first.calls == 4);
+        REQUIRE(first.samples == 2);
+        REQUIRE(first.type.ends_with("first_impl"));
+        REQUIRE(second.calls == 1);
+        REQUIRE(second.samples == 0);
+        REQUIRE(second.type.ends_with("second_impl"));
+        REQUIRE(first.mapping == second.mapping);
+    }
+
+    SECTION("dispatch capture")
+    {
+        struct facade : proxy_facade<facade>
+        {
+            using dispatch_type [[maybe_unused]] = proxy_dispatch_instrumented<TestType>;
+
+            int id() const
+            {
+                constexpr auto func = [](const auto& self) { return self.id(); };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        struct first_impl
+        {
+            int id() const
+            {
+                return 1;
+            }
+        };
+
+        struct second_impl
+        {
+            int id() const
+            {
+                return 2;
+            }
+        };
+
+        value_proxy<facade> p1 = proxies::make_value<facade>(first_impl {});
+        value_proxy<facade> p2 = proxies::make_value<facade>(second_impl {});
+
+        REQUIRE(p1.id() == 1);
+
+        proxies::capture_begin();
+
+        REQUIRE(p1.id() == 1);
+        REQUIRE(p2.id() == 2);
+        REQUIRE(p1.id() == 1);
+
+        std::thread {[&] {
+            REQUIRE(p2.id() == 2);
+        }}.join();
+
+        proxies::capture_end();
+
+        REQUIRE(p2.id() == 2);
+
+        // local types of this test share their names, so records are told apart by their type index
+        const auto of_facade = [](const proxy_capture& capture, const std::uint32_t mapping_id) {
+            const auto mapping = std::ranges::find(capture.mappings, mapping_id, &proxy_capture_mapping::id);
+            REQUIRE(mapping != capture.mappings.end());
+            return mapping->facade == proxies::detail::type_name<facade>();
+        };
+
+        const auto records_of = [&](const proxy_capture& capture) {
+            std::vector<std::vector<std::uint32_t>> threads;
+
+            for (const std::vector<proxy_capture_record>& records : capture.threads)
+            {
+                std::vector<std::uint32_t>& type_indices = threads.emplace_back();
+
+                for (const proxy_capture_record& record : records)
+                {
+                    if (record.type_index == p1.type_index() or record.type_index == p2.type_index())
+                    {
+                        REQUIRE(of_facade(capture, record.mapping));
+                        type_indices.push_back(record.type_index);
+                    }
+                }
+            }
+
+            std::erase_if(threads, [](const std::vector<std::uint32_t>& type_indices) { return type_indices.empty(); });
+            std::ranges::sort(threads, {}, &std::vector<std::uint32_t>::size);
+            return threads;
+        };
+
+        const proxy_capture capture = proxies::capture_snapshot();
+        const std::vector<std::vector<std::uint32_t>> threads = records_of(capture);
+
+        REQUIRE(threads.size() == 2);
+        REQUIRE(threads[0] == std::vector {p2.type_index()});
+        REQUIRE(threads[1] == std::vector {p1.type_index(), p2.type_index(), p1.type_index()});
+
+        // a type is looked up by its mapping and its index
+        const auto type = std::ranges::find_if(capture.types, [&](const proxy_capture_type& type) {
+            return type.type_index == p2.type_index() and of_facade(capture, type.mapping);
+        });
+        REQUIRE(type != capture.types.end());
+        REQUIRE(type->name.ends_with("second_impl"));
+
+        std::stringstream stream;
+        proxies::capture_write(stream, capture);
+
+        const proxy_capture read = proxies::capture_read(stream);
+
+        REQUIRE(records_of(read) == threads);
+        REQUIRE(std::ranges::equal(read.types, capture.types, {}, &proxy_capture_type::mapping, &proxy_capture_type::mapping));
+
+        // a count larger than the rest of the stream throws instead of allocating
+        std::string bytes = stream.str();
+        std::stringstream corrupted {bytes.replace(8, 4, "\xff\xff\xff\x7f")};
+
+        REQUIRE_THROWS_AS(proxies::capture_read(corrupted), std::runtime_error);
+    }
+
+    SECTION("speculative dispatch")
+    {
+        using facade = proxies::tests::speculative::facade<proxy_dispatch_instrumented<TestType>>;
+
+        value_proxy<facade> hot = proxies::make_value<facade>(proxies::tests::speculative::hot_impl {});
+        value_proxy<facade> cold = proxies::make_value<facade>(proxies::tests::speculative::cold_impl {});
+
+        REQUIRE(hot.id() == 1);
+        REQUIRE(cold.id() == 2);
+
+        // only the cold value goes through the wrapped dispatcher
+        const auto calls_of = [](const std::uint32_t type_index) {
+            const std::vector<proxy_dispatch_entry> entries = proxies::dispatch_snapshot();
+
+            const auto it = std::ranges::find_if(entries, [&](const proxy_dispatch_entry& entry) {
+                return entry.type_index == type_index and entry.facade_id == proxies::facade_id<facade>();
+            });
+
+            return it != entries.end() ? it->calls : 0;
+        };
+
+#ifdef SPORE_PROXY_INSTRUMENT
+        // profiling builds count every dispatch instead
+        REQUIRE(calls_of(hot.type_index()) == 1);
+#else
+        REQUIRE(calls_of(hot.type_index()) == 0);
+#endif
+        REQUIRE(calls_of(cold.type_index()) == 1);
+    }
+
+    SECTION("registry")
+    {
+        struct registry_base : proxy_facade<registry_base>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            int id() const
+            {
+                constexpr auto func = [](const auto& self) { return self.id(); };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        struct registry_facade : proxy_facade<registry_facade, registry_base>
+        {
+            using dispatch_type [[maybe_unused]] = TestType;
+
+            int twice() const
+            {
+                constexpr auto func = [](const auto& self) { return self.id() * 2; };
+                return proxies::dispatch<int>(func, *this);
+            }
+        };
+
+        struct registry_first_impl
+        {
+            int id() const
+            {
+                return 1;
+            }
+        };
+
+        struct registry_second_impl
+        {
+            int id() const
+            {
+                return 2;
+            }
+        };
+
+        constexpr bool is_dynamic = std::is_same_v<TestType, proxy_dispatch_dynamic<>>;
+        const std::string_view dispatcher = proxies::detail::type_name<TestType>();
+
+        value_proxy<registry_facade> p1 = proxies::make_value<registry_facade>(registry_first_impl {});
+        value_proxy<registry_facade> p2 = proxies::make_value<registry_facade>(registry_second_impl {});
+
+        REQUIRE(p1.id() == 1);
+        REQUIRE(p2.twice() == 4);
+
+        const auto find_facade = [&](const proxy_registry_snapshot& snapshot, const std::string_view name) {
+            const auto it = std::ranges::find_if(snapshot.facades, [&](const proxy_registry_facade& facade) {
+                return facade.name.ends_with(name) and facade.dispatcher == dispatcher;
+            });
+
+            REQUIRE(it != snapshot.facades.end());
+            return *it;
+        };
+
+        const auto count_tables = [&](const proxy_registry_snapshot& snapshot, const std::thread::id thread) {
+            return std::ranges::count_if(snapshot.tables, [&](const proxy_registry_table& table) {
+                return table.facade.ends_with("registry_facade") and table.dispatcher == dispatcher and table.thread == thread;
+            });
+        };
+
+        const std::thread::id table_thread = is_dynamic ? std::this_thread::get_id() : std::thread::id {};
+
+        {
+            const proxy_registry_snapshot snapshot = proxies::registry_snapshot();
+
+            const proxy_registry_facade facade = find_facade(snapshot, "registry_facade");
+            const proxy_registry_facade base = find_facade(snapshot, "registry_base");
+
+            REQUIRE(facade.values.size() == 2);
+            REQUIRE(facade.mappings.size() == 1);
+            REQUIRE(facade.bases.size() == 1);
+            REQUIRE(facade.bases.front() == base.name);
+            REQUIRE(base.values == facade.values);
+            REQUIRE(base.mappings.size() == 1);
+            REQUIRE(base.bases.empty());
+
+            const auto table = std::ranges::find_if(snapshot.tables, [&](const proxy_registry_table& table) {
+                return table.mapping == facade.mappings.front() and table.dispatcher == dispatcher and table.thread == table_thread;
+            });
+
+            REQUIRE(table != snapshot.tables.end());
+            REQUIRE(table->fill == 2);
+            REQUIRE(table->size > p2.type_index());
+            REQUIRE(table->bytes >= table->size * sizeof(void*));
+
+            const auto totals = std::ranges::find(snapshot.dispatchers, dispatcher, &proxy_registry_dispatcher::name);
+
+            REQUIRE(totals != snapshot.dispatchers.end());
+            REQUIRE(totals->bytes >= table->bytes);
+        }
+
+        std::thread::id thread_id;
+
+        std::thread {[&] {
+            thread_id = std::this_thread::get_id();
+
+            REQUIRE(p2.twice() == 4);
+            REQUIRE(count_tables(proxies::registry_snapshot(), is_dynamic ? thread_id : std::thread::id {}) == 1);
+        }}.join();
+
+        REQUIRE(count_tables(proxies::registry_snapshot(), thread_id) == 0);
+    }
+
     SECTION("facade template")
     {
         constexpr std::size_t result_count = 32;
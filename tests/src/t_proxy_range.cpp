@@ -0,0 +1,98 @@
+#include "catch2/catch_all.hpp"
+
+#include "spore/proxy/proxy_range.hpp"
+
+#include <forward_list>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+TEST_CASE("spore::proxy::range", "[spore::proxy][spore::proxy::range]")
+{
+    using namespace spore;
+
+    static_assert(std::ranges::input_range<proxy_range<int>>);
+    static_assert(not std::ranges::forward_range<proxy_range<int>>);
+
+    SECTION("contiguous range")
+    {
+        std::vector<int> values(1000);
+        std::iota(values.begin(), values.end(), 0);
+
+        std::vector<int> read;
+
+        for (const int value : proxies::make_range<int, 64>(values))
+        {
+            read.push_back(value);
+        }
+
+        REQUIRE(read == values);
+    }
+
+    SECTION("owned range")
+    {
+        proxy_range<long, 3> range = proxies::make_range<long, 3>(std::forward_list<int> {1, 2, 3, 4, 5, 6, 7});
+
+        long sum = 0;
+
+        for (const long value : range)
+        {
+            sum += value;
+        }
+
+        REQUIRE(sum == 28);
+    }
+
+    SECTION("empty range")
+    {
+        proxy_range<int> range = proxies::make_range<int>(std::vector<int> {});
+
+        REQUIRE(range.begin() == range.end());
+    }
+
+    SECTION("pipeline")
+    {
+        auto range = proxies::make_range<int, 16>(std::views::iota(0, 100));
+        auto even = range | std::views::filter([](const int value) { return value % 2 == 0; });
+
+        int sum = 0;
+
+        for (const int value : even)
+        {
+            sum += value;
+        }
+
+        REQUIRE(sum == 2450);
+    }
+
+    SECTION("custom source")
+    {
+        struct countdown
+        {
+            int from = 0;
+
+            std::size_t next_chunk(const std::span<int> chunk)
+            {
+                std::size_t count = 0;
+
+                for (; count < chunk.size() and from > 0; ++count)
+                {
+                    chunk[count] = from--;
+                }
+
+                return count;
+            }
+        };
+
+        proxy_range<int, 4> range {proxies::make_unique<proxy_range_facade<int>>(countdown {.from = 10})};
+
+        std::vector<int> read;
+
+        for (const int value : range)
+        {
+            read.push_back(value);
+        }
+
+        REQUIRE(read == std::vector<int> {10, 9, 8, 7, 6, 5, 4, 3, 2, 1});
+    }
+}
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "spore/proxy/proxy.hpp"
 #include "spore/proxy/tests/t_observable.hpp"
 
+#include <thread>
+
 TEST_CASE("spore::proxy::storage", "[spore::proxy][spore::proxy::storage]")
 {
     using namespace spore;
@@ -12,61 +14,626 @@ TEST_CASE("spore::proxy::storage", "[spore::proxy][spore::proxy::storage]")
     {
         using proxy_storage_shared_t = proxy_storage_shared<std::uint32_t>;
 
+        static_assert(sizeof(proxy_storage_shared_t) == sizeof(void*));
+
         SECTION("in-place construction")
         {
             proxy_storage_shared_t s {std::in_place_type<impl>};
 
-            REQUIRE(s.counter() == 1);
-            REQUIRE(s.ptr() != nullptr);
+            REQUIRE(s.counter() == 1);
+            REQUIRE(s.ptr() != nullptr);
+        }
+
+        SECTION("copy")
+        {
+            bool copied = false;
+            bool moved = false;
+
+            proxy_storage_shared_t s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
+            proxy_storage_shared_t s2 = s1;
+
+            REQUIRE(s1.ptr() == s2.ptr());
+            REQUIRE(s1.counter() == 2);
+            REQUIRE(s2.counter() == 2);
+            REQUIRE(std::addressof(s1.counter()) == std::addressof(s2.counter()));
+
+            void* ptr = s1.ptr();
+            s2.reset();
+
+            REQUIRE(s1.counter() == 1);
+            REQUIRE(s1.ptr() == ptr);
+
+            REQUIRE_FALSE(copied);
+            REQUIRE_FALSE(moved);
+        }
+
+        SECTION("move")
+        {
+            bool copied = false;
+            bool moved = false;
+
+            proxy_storage_shared_t s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
+
+            void* ptr = s1.ptr();
+
+            proxy_storage_shared_t s2 = std::move(s1);
+
+            REQUIRE(s1.ptr() == nullptr);
+            REQUIRE(s2.counter() == 1);
+            REQUIRE(s2.ptr() == ptr);
+
+            REQUIRE_FALSE(copied);
+            REQUIRE_FALSE(moved);
+        }
+
+        SECTION("destruction")
+        {
+            bool destroyed = false;
+
+            proxy_storage_shared_t s {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+
+            s.reset();
+
+            REQUIRE(s.ptr() == nullptr);
+            REQUIRE(destroyed);
+        }
+    }
+
+    SECTION("padded shared storage")
+    {
+        using proxy_storage_shared_t = proxy_storage_shared<std::atomic<std::uint32_t>, true>;
+
+        static_assert(sizeof(proxy_storage_shared_t) == sizeof(void*));
+
+        proxy_storage_shared_t s {std::in_place_type<impl>};
+
+        const auto counter_address = reinterpret_cast<std::uintptr_t>(std::addressof(s.counter()));
+        const auto value_address = reinterpret_cast<std::uintptr_t>(s.ptr());
+
+        REQUIRE(value_address % proxies::detail::cache_line_size == 0);
+        REQUIRE(counter_address / proxies::detail::cache_line_size != value_address / proxies::detail::cache_line_size);
+    }
+
+    SECTION("over-aligned shared storage")
+    {
+        struct alignas(128) over_aligned_impl : impl
+        {
+            using impl::impl;
+        };
+
+        bool destroyed = false;
+
+        proxy_storage_shared<std::uint32_t> s {std::in_place_type<over_aligned_impl>, flags {.destroyed = destroyed}};
+
+        REQUIRE(reinterpret_cast<std::uintptr_t>(s.ptr()) % alignof(over_aligned_impl) == 0);
+        REQUIRE(s.type_info() == std::addressof(proxies::detail::type_info<over_aligned_impl>()));
+
+        s.reset();
+
+        REQUIRE(destroyed);
+    }
+
+    SECTION("weak shared storage")
+    {
+        using proxy_storage_shared_t = proxy_storage_shared<std::atomic<std::uint32_t>>;
+        using weak_storage_t = proxy_storage_shared_t::weak_storage;
+
+        static_assert(sizeof(weak_storage_t) == sizeof(void*));
+
+        SECTION("lock")
+        {
+            proxy_storage_shared_t s1 {std::in_place_type<impl>};
+            weak_storage_t w {s1};
+
+            REQUIRE_FALSE(w.expired());
+
+            proxy_storage_shared_t s2 = w.lock();
+
+            REQUIRE(s2.ptr() == s1.ptr());
+            REQUIRE(s1.counter() == 2);
+        }
+
+        SECTION("expiration")
+        {
+            bool destroyed = false;
+
+            proxy_storage_shared_t s {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+            weak_storage_t w1 {s};
+            weak_storage_t w2 = w1;
+
+            s.reset();
+
+            REQUIRE(destroyed);
+            REQUIRE(w1.expired());
+            REQUIRE(w2.expired());
+            REQUIRE(w1.lock().ptr() == nullptr);
+
+            w1.reset();
+
+            REQUIRE(w1.expired());
+            REQUIRE(w2.lock().ptr() == nullptr);
+        }
+
+        SECTION("self-assignment")
+        {
+            proxy_storage_shared_t s {std::in_place_type<impl>};
+            weak_storage_t w {s};
+            const weak_storage_t& self = w;
+
+            w = self;
+
+            REQUIRE_FALSE(w.expired());
+            REQUIRE(w.lock().ptr() == s.ptr());
+        }
+
+        SECTION("lock across threads")
+        {
+            constexpr std::size_t thread_count = SPORE_PROXY_TEST_THREAD_COUNT;
+
+            bool destroyed = false;
+
+            proxy_storage_shared_t s {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+            weak_storage_t w {s};
+
+            std::atomic<std::size_t> locked = 0;
+            std::vector<std::thread> threads;
+
+            for (std::size_t index = 0; index < thread_count; ++index)
+            {
+                threads.emplace_back([&] {
+                    for (std::size_t iteration = 0; iteration < 1000; ++iteration)
+                    {
+                        if (proxy_storage_shared_t storage = w.lock(); storage.ptr() != nullptr)
+                        {
+                            ++locked;
+                        }
+                    }
+                });
+            }
+
+            s.reset();
+
+            std::ranges::for_each(threads, [](std::thread& thread) { thread.join(); });
+
+            REQUIRE(destroyed);
+            REQUIRE(w.expired());
+            REQUIRE(locked <= thread_count * 1000);
+        }
+    }
+
+    SECTION("biased shared storage")
+    {
+        using proxy_storage_shared_t = proxy_storage_shared<proxy_counter_biased>;
+
+        SECTION("in-place construction")
+        {
+            proxy_storage_shared_t s {std::in_place_type<impl>};
+
+            REQUIRE(s.counter().use_count() == 1);
+            REQUIRE(s.ptr() != nullptr);
+        }
+
+        SECTION("owner copy")
+        {
+            proxy_storage_shared_t s1 {std::in_place_type<impl>};
+            proxy_storage_shared_t s2 = s1;
+
+            REQUIRE(s1.ptr() == s2.ptr());
+            REQUIRE(s1.counter().biased == 2);
+            REQUIRE(s1.counter().shared == 0);
+
+            s2.reset();
+
+            REQUIRE(s1.counter().biased == 1);
+        }
+
+        SECTION("non-owner copy")
+        {
+            bool destroyed = false;
+
+            proxy_storage_shared_t s1 {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+
+            std::int64_t use_count = 0;
+
+            std::thread {[&] {
+                proxy_storage_shared_t s2 = s1;
+                use_count = s1.counter().use_count();
+            }}.join();
+
+            REQUIRE(use_count == 2);
+            REQUIRE(s1.counter().biased == 1);
+            REQUIRE(s1.counter().use_count() == 1);
+
+            s1.reset();
+
+            REQUIRE(destroyed);
+        }
+
+        SECTION("non-owner destruction")
+        {
+            bool destroyed = false;
+
+            proxy_storage_shared_t s1 {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+            proxy_storage_shared_t s2 = s1;
+
+            s1.reset();
+
+            std::thread {[&] { s2.reset(); }}.join();
+
+            REQUIRE_FALSE(destroyed);
+
+            proxy_counter_biased::merge_pending();
+
+            REQUIRE(destroyed);
+        }
+
+        SECTION("owner exit")
+        {
+            bool destroyed = false;
+
+            proxy_storage_shared_t s;
+
+            std::thread {[&] { s = proxy_storage_shared_t {std::in_place_type<impl>, flags {.destroyed = destroyed}}; }}.join();
+
+            REQUIRE_FALSE(destroyed);
+
+            s.reset();
+
+            REQUIRE(destroyed);
+        }
+
+        SECTION("owner exit and later threads")
+        {
+            bool destroyed = false;
+
+            proxy_storage_shared_t s;
+
+            std::thread {[&] { s = proxy_storage_shared_t {std::in_place_type<impl>, flags {.destroyed = destroyed}}; }}.join();
+
+            // a later thread may get the thread-local storage of the exited owner, but never its id
+            std::thread {[&] {
+                proxy_storage_shared_t local {std::in_place_type<impl>};
+                proxy_storage_shared_t copy = s;
+
+                REQUIRE(local.counter().owner != s.counter().owner);
+                REQUIRE(s.counter().biased == 1);
+                REQUIRE(s.counter().use_count() == 2);
+            }}.join();
+
+            REQUIRE_FALSE(destroyed);
+
+            s.reset();
+
+            REQUIRE(destroyed);
+        }
+    }
+
+    SECTION("cow storage")
+    {
+        static_assert(sizeof(proxy_storage_cow) == sizeof(void*));
+
+        SECTION("copy")
+        {
+            bool copied = false;
+
+            proxy_storage_cow s1 {std::in_place_type<impl>, flags {.copied = copied}};
+            proxy_storage_cow s2 = s1;
+
+            REQUIRE(s1.ptr() == s2.ptr());
+            REQUIRE(s1.counter() == 2);
+            REQUIRE_FALSE(copied);
+        }
+
+        SECTION("detach")
+        {
+            bool copied = false;
+
+            proxy_storage_cow s1 {std::in_place_type<impl>, flags {.copied = copied}};
+            proxy_storage_cow s2 = s1;
+
+            s2.detach();
+
+            REQUIRE(s1.ptr() != s2.ptr());
+            REQUIRE(s1.counter() == 1);
+            REQUIRE(s2.counter() == 1);
+            REQUIRE(copied);
+        }
+
+        SECTION("unique detach")
+        {
+            bool copied = false;
+
+            proxy_storage_cow s {std::in_place_type<impl>, flags {.copied = copied}};
+
+            void* ptr = s.ptr();
+
+            s.detach();
+
+            REQUIRE(s.ptr() == ptr);
+            REQUIRE_FALSE(copied);
+        }
+
+        SECTION("storage construction")
+        {
+            bool copied = false;
+
+            proxy_storage_value s1 {std::in_place_type<impl>, flags {.copied = copied}};
+            proxy_storage_cow s2 {s1};
+
+            REQUIRE(s2.ptr() != nullptr);
+            REQUIRE(s2.type_info() == s1.type_info());
+            REQUIRE(copied);
+        }
+
+        SECTION("destruction")
+        {
+            bool destroyed = false;
+
+            proxy_storage_cow s1 {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+            proxy_storage_cow s2 = s1;
+
+            s1.reset();
+
+            REQUIRE_FALSE(destroyed);
+
+            s2.reset();
+
+            REQUIRE(destroyed);
+        }
+    }
+
+    SECTION("intrusive storage")
+    {
+        static_assert(sizeof(proxy_storage_intrusive) == 2 * sizeof(void*));
+
+        SECTION("in-place construction")
+        {
+            proxy_storage_intrusive s {std::in_place_type<intrusive_impl>};
+
+            REQUIRE(s.ptr() != nullptr);
+            REQUIRE(static_cast<intrusive_impl*>(s.ptr())->count == 1);
+        }
+
+        SECTION("adoption")
+        {
+            bool destroyed = false;
+
+            auto* value = new intrusive_impl {flags {.destroyed = destroyed}};
+            proxy_intrusive_add_ref(*value);
+
+            {
+                proxy_storage_intrusive s {std::in_place_type<intrusive_impl>, proxy_adopt, value};
+
+                REQUIRE(s.ptr() == value);
+                REQUIRE(value->count == 2);
+            }
+
+            REQUIRE(value->count == 1);
+            REQUIRE_FALSE(destroyed);
+
+            proxy_intrusive_release(*value);
+
+            REQUIRE(destroyed);
+        }
+
+        SECTION("copy")
+        {
+            bool copied = false;
+            bool moved = false;
+
+            proxy_storage_intrusive s1 {std::in_place_type<intrusive_impl>, flags {.copied = copied, .moved = moved}};
+            proxy_storage_intrusive s2 = s1;
+
+            REQUIRE(s1.ptr() == s2.ptr());
+            REQUIRE(static_cast<intrusive_impl*>(s1.ptr())->count == 2);
+
+            s2.reset();
+
+            REQUIRE(static_cast<intrusive_impl*>(s1.ptr())->count == 1);
+
+            REQUIRE_FALSE(copied);
+            REQUIRE_FALSE(moved);
+        }
+
+        SECTION("move")
+        {
+            bool copied = false;
+            bool moved = false;
+
+            proxy_storage_intrusive s1 {std::in_place_type<intrusive_impl>, flags {.copied = copied, .moved = moved}};
+
+            void* ptr = s1.ptr();
+
+            proxy_storage_intrusive s2 = std::move(s1);
+
+            REQUIRE(s1.ptr() == nullptr);
+            REQUIRE(s2.ptr() == ptr);
+            REQUIRE(static_cast<intrusive_impl*>(s2.ptr())->count == 1);
+
+            REQUIRE_FALSE(copied);
+            REQUIRE_FALSE(moved);
+        }
+
+        SECTION("destruction")
+        {
+            bool destroyed = false;
+
+            proxy_storage_intrusive s {std::in_place_type<intrusive_impl>, flags {.destroyed = destroyed}};
+
+            s.reset();
+
+            REQUIRE(s.ptr() == nullptr);
+            REQUIRE(destroyed);
+        }
+    }
+
+    SECTION("unique storage")
+    {
+        static_assert(not std::is_copy_constructible_v<proxy_storage_unique>);
+        static_assert(not std::is_copy_assignable_v<proxy_storage_unique>);
+
+        SECTION("in-place construction")
+        {
+            proxy_storage_unique s {std::in_place_type<impl>};
+
+            REQUIRE(s.ptr() != nullptr);
+        }
+
+        SECTION("move")
+        {
+            bool copied = false;
+            bool moved = false;
+
+            proxy_storage_unique s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
+
+            void* ptr = s1.ptr();
+
+            proxy_storage_unique s2 = std::move(s1);
+
+            REQUIRE(s1.ptr() == nullptr);
+            REQUIRE(s2.ptr() == ptr);
+
+            REQUIRE_FALSE(moved);
+            REQUIRE_FALSE(copied);
+        }
+
+        SECTION("destruction")
+        {
+            bool destroyed = false;
+
+            proxy_storage_unique s {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+
+            s.reset();
+
+            REQUIRE(s.ptr() == nullptr);
+            REQUIRE(destroyed);
+        }
+
+        SECTION("adoption")
+        {
+            bool destroyed = false;
+
+            std::unique_ptr<impl, deleter> value {new impl {flags {.destroyed = destroyed}}};
+            impl* ptr = value.get();
+
+            const std::size_t count = deleter::count;
+
+            proxy_storage_unique s {std::in_place_type<impl>, proxy_adopt, std::move(value)};
+
+            REQUIRE(value == nullptr);
+            REQUIRE(s.ptr() == ptr);
+            REQUIRE(s.type_info() == std::addressof(proxies::detail::type_info<impl>()));
+
+            s.reset();
+
+            REQUIRE(destroyed);
+            REQUIRE(deleter::count == count + 1);
+        }
+    }
+
+    SECTION("shared pointer storage")
+    {
+        SECTION("in-place construction")
+        {
+            proxy_storage_shared_ptr s {std::in_place_type<impl>};
+
+            REQUIRE(s.ptr() != nullptr);
+            REQUIRE(s.use_count() == 1);
+        }
+
+        SECTION("adoption")
+        {
+            bool copied = false;
+            bool moved = false;
+
+            std::shared_ptr<impl> value = std::make_shared<impl>(flags {.copied = copied, .moved = moved});
+            impl* ptr = value.get();
+
+            proxy_storage_shared_ptr s {std::in_place_type<impl>, proxy_adopt, std::shared_ptr {value}};
+
+            REQUIRE(s.ptr() == ptr);
+            REQUIRE(s.use_count() == 2);
+
+            REQUIRE_FALSE(moved);
+            REQUIRE_FALSE(copied);
+        }
+
+        SECTION("copy")
+        {
+            proxy_storage_shared_ptr s1 {std::in_place_type<impl>};
+            proxy_storage_shared_ptr s2 = s1;
+
+            REQUIRE(s1.ptr() == s2.ptr());
+            REQUIRE(s1.use_count() == 2);
+        }
+
+        SECTION("destruction")
+        {
+            bool destroyed = false;
+
+            std::shared_ptr<impl> value = std::make_shared<impl>(flags {.destroyed = destroyed});
+
+            proxy_storage_shared_ptr s {std::in_place_type<impl>, proxy_adopt, std::move(value)};
+
+            s.reset();
+
+            REQUIRE(s.ptr() == nullptr);
+            REQUIRE(s.type_info() == nullptr);
+            REQUIRE(destroyed);
+        }
+    }
+
+    SECTION("external storage")
+    {
+        alignas(impl) std::array<std::byte, sizeof(impl)> buffer {};
+
+        SECTION("in-place construction")
+        {
+            proxy_storage_external s {std::in_place_type<impl>, buffer};
+
+            REQUIRE(s.ptr() == buffer.data());
+            REQUIRE(s.buffer().size() == buffer.size());
+        }
+
+        SECTION("too small buffer")
+        {
+            REQUIRE_FALSE(proxy_storage_external::is_constructible(std::span {buffer}.first(sizeof(impl) - 1), proxies::detail::type_info<impl>()));
+            REQUIRE_FALSE(proxy_storage_external::is_constructible(std::span {buffer}.subspan(1), proxies::detail::type_info<impl>()));
+            REQUIRE_THROWS_AS((proxy_storage_external {std::in_place_type<impl>, std::span {buffer}.subspan(1)}), std::runtime_error);
         }
 
-        SECTION("copy")
+        SECTION("move")
         {
             bool copied = false;
             bool moved = false;
 
-            proxy_storage_shared_t s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
-            proxy_storage_shared_t s2 = s1;
-
-            REQUIRE(s1.ptr() == s2.ptr());
-            REQUIRE(s1.counter() == 2);
-            REQUIRE(s2.counter() == 2);
-            REQUIRE(std::addressof(s1.counter()) == std::addressof(s2.counter()));
-
-            void* ptr = s1.ptr();
-            s2.reset();
+            proxy_storage_external s1 {std::in_place_type<impl>, buffer, flags {.copied = copied, .moved = moved}};
+            proxy_storage_external s2 = std::move(s1);
 
-            REQUIRE(s1.counter() == 1);
-            REQUIRE(s1.ptr() == ptr);
+            REQUIRE(s1.ptr() == nullptr);
+            REQUIRE(s2.ptr() == buffer.data());
 
-            REQUIRE_FALSE(copied);
             REQUIRE_FALSE(moved);
+            REQUIRE_FALSE(copied);
         }
 
-        SECTION("move")
+        SECTION("storage construction")
         {
-            bool copied = false;
             bool moved = false;
 
-            proxy_storage_shared_t s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
-
-            void* ptr = s1.ptr();
-
-            proxy_storage_shared_t s2 = std::move(s1);
-
-            REQUIRE(s1.ptr() == nullptr);
-            REQUIRE(s2.counter() == 1);
-            REQUIRE(s2.ptr() == ptr);
+            proxy_storage_value s1 {std::in_place_type<impl>, flags {.moved = moved}};
+            proxy_storage_external s2 {buffer, std::move(s1)};
 
-            REQUIRE_FALSE(copied);
-            REQUIRE_FALSE(moved);
+            REQUIRE(s2.ptr() == buffer.data());
+            REQUIRE(s2.type_info() == s1.type_info());
+            REQUIRE(moved);
         }
 
         SECTION("destruction")
         {
             bool destroyed = false;
 
-            proxy_storage_shared_t s {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+            proxy_storage_external s {std::in_place_type<impl>, buffer, flags {.destroyed = destroyed}};
 
             s.reset();
 
@@ -75,46 +642,102 @@ TEST_CASE("spore::proxy::storage", "[spore::proxy][spore::proxy::storage]")
         }
     }
 
-    SECTION("unique storage")
+    SECTION("lazy storage")
     {
-        static_assert(not std::is_copy_constructible_v<proxy_storage_unique>);
-        static_assert(not std::is_copy_assignable_v<proxy_storage_unique>);
-
         SECTION("in-place construction")
         {
-            proxy_storage_unique s {std::in_place_type<impl>};
+            bool moved = false;
+            bool destroyed = false;
 
-            REQUIRE(s.ptr() != nullptr);
+            proxy_storage_lazy s {std::in_place_type<impl>, flags {.moved = moved, .destroyed = destroyed}};
+
+            REQUIRE_FALSE(s.is_constructed());
+            REQUIRE(s.type_info() == std::addressof(proxies::detail::type_info<impl>()));
+
+            void* ptr = s.ptr();
+
+            REQUIRE(ptr != nullptr);
+            REQUIRE(s.is_constructed());
+            REQUIRE(s.ptr() == ptr);
+
+            s.reset();
+
+            REQUIRE(destroyed);
+        }
+
+        SECTION("boxed arguments")
+        {
+            struct large_impl
+            {
+                std::array<std::byte, proxy_storage_lazy<>::args_size + 1> bytes;
+            };
+
+            proxy_storage_lazy s {std::in_place_type<large_impl>, std::array<std::byte, proxy_storage_lazy<>::args_size + 1> {std::byte {1}}};
+
+            REQUIRE(static_cast<large_impl*>(s.ptr())->bytes[0] == std::byte {1});
         }
 
         SECTION("move")
         {
-            bool copied = false;
-            bool moved = false;
+            bool destroyed = false;
 
-            proxy_storage_unique s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
+            proxy_storage_lazy s1 {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+            proxy_storage_lazy s2 = std::move(s1);
 
-            void* ptr = s1.ptr();
+            REQUIRE(s1.type_info() == nullptr);
+            REQUIRE_FALSE(s2.is_constructed());
+            REQUIRE(s2.ptr() != nullptr);
 
-            proxy_storage_unique s2 = std::move(s1);
+            void* ptr = s2.ptr();
 
-            REQUIRE(s1.ptr() == nullptr);
-            REQUIRE(s2.ptr() == ptr);
+            proxy_storage_lazy s3 = std::move(s2);
 
-            REQUIRE_FALSE(moved);
-            REQUIRE_FALSE(copied);
+            REQUIRE(s2.ptr() == nullptr);
+            REQUIRE(s3.ptr() == ptr);
+            REQUIRE_FALSE(destroyed);
         }
 
         SECTION("destruction")
         {
             bool destroyed = false;
 
-            proxy_storage_unique s {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+            proxy_storage_lazy s {std::in_place_type<impl>, flags {.destroyed = destroyed}};
 
             s.reset();
 
             REQUIRE(s.ptr() == nullptr);
-            REQUIRE(destroyed);
+            REQUIRE(s.type_info() == nullptr);
+
+            // only the captured flags were destroyed
+            REQUIRE_FALSE(destroyed);
+        }
+
+        SECTION("multi-threaded construction")
+        {
+            static std::atomic<std::size_t> constructions = 0;
+
+            struct counted_impl
+            {
+                counted_impl()
+                {
+                    constructions.fetch_add(1, std::memory_order_relaxed);
+                }
+            };
+
+            proxy_storage_lazy<true> s {std::in_place_type<counted_impl>};
+
+            std::array<void*, 8> ptrs {};
+            std::vector<std::thread> threads;
+
+            for (void*& ptr : ptrs)
+            {
+                threads.emplace_back([&] { ptr = s.ptr(); });
+            }
+
+            std::ranges::for_each(threads, [](std::thread& thread) { thread.join(); });
+
+            REQUIRE(constructions == 1);
+            REQUIRE(std::ranges::all_of(ptrs, [&](void* ptr) { return ptr == s.ptr(); }));
         }
     }
 
@@ -200,13 +823,32 @@ TEST_CASE("spore::proxy::storage", "[spore::proxy][spore::proxy::storage]")
             proxy_storage_sbo_t s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
             proxy_storage_sbo_t s2 = std::move(s1);
 
-            REQUIRE(s1.ptr() != nullptr);
+            REQUIRE(s1.ptr() == nullptr);
             REQUIRE(s2.ptr() != nullptr);
 
             REQUIRE(moved);
             REQUIRE_FALSE(copied);
         }
 
+        SECTION("relocation")
+        {
+            bool moved = false;
+            bool destroyed = false;
+
+            proxy_storage_sbo_t s1 {std::in_place_type<relocatable_impl>, flags {.moved = moved, .destroyed = destroyed}};
+            proxy_storage_sbo_t s2 = std::move(s1);
+
+            REQUIRE(s1.ptr() == nullptr);
+            REQUIRE(s2.ptr() != nullptr);
+
+            REQUIRE_FALSE(moved);
+            REQUIRE_FALSE(destroyed);
+
+            s2.reset();
+
+            REQUIRE(destroyed);
+        }
+
         SECTION("destruction")
         {
             bool destroyed = false;
@@ -220,6 +862,224 @@ TEST_CASE("spore::proxy::storage", "[spore::proxy][spore::proxy::storage]")
         }
     }
 
+    SECTION("chain storage")
+    {
+        using proxy_storage_chain_t = proxy_storage_chain<proxy_storage_sbo<sizeof(impl), alignof(impl)>, proxy_storage_value>;
+        using proxy_storage_heap_chain_t = proxy_storage_chain<proxy_storage_sbo<1, 1>, proxy_storage_value>;
+
+        static_assert(sizeof(proxy_storage_chain_t) == sizeof(void*) + sizeof(impl));
+
+        SECTION("in-place construction")
+        {
+            proxy_storage_chain_t s1 {std::in_place_type<impl>};
+            proxy_storage_heap_chain_t s2 {std::in_place_type<impl>};
+
+            const auto* begin = reinterpret_cast<const std::byte*>(std::addressof(s1));
+            const auto* end = begin + sizeof(s1);
+
+            REQUIRE(s1.ptr() >= begin);
+            REQUIRE(s1.ptr() < end);
+            REQUIRE(s2.ptr() != nullptr);
+        }
+
+        SECTION("copy")
+        {
+            bool copied = false;
+            bool moved = false;
+
+            proxy_storage_heap_chain_t s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
+            proxy_storage_heap_chain_t s2 = s1;
+
+            REQUIRE(s1.ptr() != s2.ptr());
+            REQUIRE(copied);
+            REQUIRE_FALSE(moved);
+        }
+
+        SECTION("move")
+        {
+            bool copied = false;
+            bool moved = false;
+
+            proxy_storage_chain_t s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
+            proxy_storage_chain_t s2 = std::move(s1);
+
+            REQUIRE(s1.ptr() == nullptr);
+            REQUIRE(s2.ptr() != nullptr);
+
+            REQUIRE(moved);
+            REQUIRE_FALSE(copied);
+        }
+
+        SECTION("throwing move construction")
+        {
+            struct throwing_impl
+            {
+                throwing_impl() = default;
+
+                throwing_impl(throwing_impl&&) noexcept(false)
+                {
+                }
+            };
+
+            proxy_storage_chain_t s {std::in_place_type<throwing_impl>};
+
+            const auto* begin = reinterpret_cast<const std::byte*>(std::addressof(s));
+            const auto* end = begin + sizeof(s);
+
+            REQUIRE(s.type_info()->nothrow_move == false);
+            REQUIRE((s.ptr() < begin or s.ptr() >= end));
+        }
+
+        SECTION("throwing copy construction")
+        {
+            struct throwing_impl
+            {
+                throwing_impl() = default;
+
+                throwing_impl(const throwing_impl&)
+                {
+                    throw std::runtime_error {"copy"};
+                }
+            };
+
+            proxy_storage_heap_chain_t s1 {std::in_place_type<throwing_impl>};
+
+            REQUIRE_THROWS_AS(proxy_storage_heap_chain_t {s1}, std::runtime_error);
+
+            proxy_storage_heap_chain_t s2;
+
+            REQUIRE_THROWS_AS(s2 = s1, std::runtime_error);
+            REQUIRE(s2.ptr() == nullptr);
+            REQUIRE(s2.type_info() == nullptr);
+        }
+
+        SECTION("heap move")
+        {
+            bool copied = false;
+            bool moved = false;
+
+            proxy_storage_heap_chain_t s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
+
+            void* ptr = s1.ptr();
+
+            proxy_storage_heap_chain_t s2 = std::move(s1);
+
+            REQUIRE(s1.ptr() == nullptr);
+            REQUIRE(s2.ptr() == ptr);
+
+            REQUIRE_FALSE(moved);
+            REQUIRE_FALSE(copied);
+        }
+
+        SECTION("destruction")
+        {
+            bool destroyed = false;
+
+            proxy_storage_heap_chain_t s {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+
+            s.reset();
+
+            REQUIRE(s.ptr() == nullptr);
+            REQUIRE(destroyed);
+        }
+    }
+
+    SECTION("variant storage")
+    {
+        using proxy_storage_variant_t = proxy_storage_variant<std::uint8_t, impl, relocatable_impl>;
+
+        static_assert(sizeof(proxy_storage_variant_t) == sizeof(impl) + alignof(impl));
+
+        SECTION("in-place construction")
+        {
+            proxy_storage_variant_t s {std::in_place_type<impl>};
+
+            const auto* begin = reinterpret_cast<const std::byte*>(std::addressof(s));
+            const auto* end = begin + sizeof(s);
+
+            REQUIRE(s.ptr() >= begin);
+            REQUIRE(s.ptr() < end);
+            REQUIRE(s.index() == 1);
+            REQUIRE(s.type_info() == std::addressof(proxies::detail::type_info<impl>()));
+        }
+
+        SECTION("copy")
+        {
+            bool copied = false;
+            bool moved = false;
+
+            proxy_storage_variant_t s1 {std::in_place_type<impl>, flags {.copied = copied, .moved = moved}};
+            proxy_storage_variant_t s2 = s1;
+
+            REQUIRE(s1.ptr() != s2.ptr());
+            REQUIRE(s2.index() == 1);
+            REQUIRE(copied);
+            REQUIRE_FALSE(moved);
+        }
+
+        SECTION("move")
+        {
+            bool moved = false;
+            bool destroyed = false;
+
+            proxy_storage_variant_t s1 {std::in_place_type<impl>, flags {.moved = moved, .destroyed = destroyed}};
+            proxy_storage_variant_t s2 = std::move(s1);
+
+            REQUIRE(s1.ptr() == nullptr);
+            REQUIRE(s2.ptr() != nullptr);
+
+            REQUIRE(moved);
+            REQUIRE(destroyed);
+        }
+
+        SECTION("relocation")
+        {
+            bool moved = false;
+            bool destroyed = false;
+
+            proxy_storage_variant_t s1 {std::in_place_type<relocatable_impl>, flags {.moved = moved, .destroyed = destroyed}};
+            proxy_storage_variant_t s2 = std::move(s1);
+
+            REQUIRE(s1.ptr() == nullptr);
+            REQUIRE(s2.index() == 2);
+
+            REQUIRE_FALSE(moved);
+            REQUIRE_FALSE(destroyed);
+        }
+
+        SECTION("storage construction")
+        {
+            bool copied = false;
+
+            static_assert(std::is_constructible_v<proxy_storage_variant_t, const proxy_storage_inline<impl>&>);
+            static_assert(std::is_constructible_v<proxy_storage_variant_t, proxy_storage_variant<relocatable_impl, impl>&&>);
+            static_assert(not std::is_constructible_v<proxy_storage_variant_t, const proxy_storage_inline<int>&>);
+            static_assert(not std::is_constructible_v<proxy_storage_variant_t, const proxy_storage_variant<impl, int>&>);
+            static_assert(not std::is_constructible_v<proxy_storage_variant_t, const proxy_storage_value&>);
+
+            proxy_storage_inline<impl> s1 {std::in_place_type<impl>, flags {.copied = copied}};
+            proxy_storage_variant_t s2 {s1};
+
+            REQUIRE(s2.index() == 1);
+            REQUIRE(proxy_storage_variant_t::is_constructible(*s1.type_info()));
+            REQUIRE_FALSE(proxy_storage_variant_t::is_constructible(proxies::detail::type_info<int>()));
+            REQUIRE(copied);
+        }
+
+        SECTION("destruction")
+        {
+            bool destroyed = false;
+
+            proxy_storage_variant_t s {std::in_place_type<impl>, flags {.destroyed = destroyed}};
+
+            s.reset();
+
+            REQUIRE(s.ptr() == nullptr);
+            REQUIRE(s.type_info() == nullptr);
+            REQUIRE(destroyed);
+        }
+    }
+
     SECTION("inline storage")
     {
         using proxy_storage_inline_t = proxy_storage_inline<impl>;
@@ -259,6 +1119,25 @@ TEST_CASE("spore::proxy::storage", "[spore::proxy][spore::proxy::storage]")
             REQUIRE_FALSE(copied);
         }
 
+        SECTION("relocation")
+        {
+            bool moved = false;
+            bool destroyed = false;
+
+            proxy_storage_inline<relocatable_impl> s1 {std::in_place_type<relocatable_impl>, flags {.moved = moved, .destroyed = destroyed}};
+            proxy_storage_inline<relocatable_impl> s2 = std::move(s1);
+
+            REQUIRE(s1.ptr() == nullptr);
+            REQUIRE(s2.ptr() != nullptr);
+
+            REQUIRE_FALSE(moved);
+            REQUIRE_FALSE(destroyed);
+
+            s2.reset();
+
+            REQUIRE(destroyed);
+        }
+
         SECTION("destruction")
         {
             bool destroyed = false;